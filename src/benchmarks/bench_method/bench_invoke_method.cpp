@@ -231,6 +231,23 @@ nonius::benchmark bench_rttr_invoke_method_arg_3()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_invoke_method_arg_3_handle()
+{
+    return nonius::benchmark("rttr - typed handle", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("void_method_arg_3");
+        auto handle = m.bind_signature<void(ns_foo::method_class&, int, int, int)>();
+
+        meter.measure([&]()
+        {
+            return handle(obj, 23, 42, 5);
+        });
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -264,6 +281,40 @@ nonius::benchmark bench_rttr_invoke_method_arg_8()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_invoke_method_arg_8_range()
+{
+    return nonius::benchmark("rttr - argument_range", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("void_method_arg_8");
+        int a1 = 1, a2 = 2, a3 = 3, a4 = 4, a5 = 5, a6 = 6, a7 = 7, a8 = 8;
+        rttr::argument args[] = {a1, a2, a3, a4, a5, a6, a7, a8};
+        meter.measure([&]()
+        {
+            return m.invoke_variadic(obj, rttr::argument_range(args, args + 8));
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_invoke_method_arg_8_handle()
+{
+    return nonius::benchmark("rttr - typed handle", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("void_method_arg_8");
+        auto handle = m.bind_signature<void(ns_foo::method_class&, int, int, int, int, int, int, int, int)>();
+
+        meter.measure([&]()
+        {
+            return handle(obj, 1, 2, 3, 4, 5, 6, 7, 8);
+        });
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -301,6 +352,78 @@ nonius::benchmark bench_rttr_invoke_method_ptr_arg()
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
+nonius::benchmark bench_native_invoke_method_overloaded()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class_overloaded obj;
+
+        meter.measure([&]()
+        {
+            obj.overloaded_method(42, 23.0);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_invoke_method_overloaded()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class_overloaded obj;
+        rttr::type t = rttr::type::get(obj);
+
+        meter.measure([&]()
+        {
+            return t.invoke("overloaded_method", obj, {42, 23.0});
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_invoke_method_overloaded_range()
+{
+    return nonius::benchmark("rttr - argument_range", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class_overloaded obj;
+        rttr::type t = rttr::type::get(obj);
+        int arg_1 = 42;
+        double arg_2 = 23.0;
+        rttr::argument args[] = {arg_1, arg_2};
+
+        meter.measure([&]()
+        {
+            return t.invoke("overloaded_method", obj, rttr::argument_range(args, args + 2));
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_invoke_method_overloaded_cache()
+{
+    return nonius::benchmark("rttr - invoke_cache", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class_overloaded obj;
+        rttr::type t = rttr::type::get(obj);
+        int arg_1 = 42;
+        double arg_2 = 23.0;
+        rttr::argument args[] = {arg_1, arg_2};
+        rttr::invoke_cache cache;
+
+        meter.measure([&]()
+        {
+            return cache.invoke(t, "overloaded_method", obj, rttr::argument_range(args, args + 2));
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void bench_invoke_method()
 {
     nonius::configuration cfg;
@@ -469,9 +592,14 @@ void bench_invoke_method()
                                               "\n"
                                               "// rttr approach\n"
                                               "m.invoke(obj, 42, 23, 5);\n"
+                                              "\n"
+                                              "// rttr approach - typed handle\n"
+                                              "auto handle = m.bind_signature<void(Foo&, int, int, int)>();\n"
+                                              "handle(obj, 42, 23, 5);\n"
                                               "</pre>");
     nonius::benchmark benchmarks_group_6[] = { bench_native_invoke_method_arg_3(),
-                                               bench_rttr_invoke_method_arg_3()};
+                                               bench_rttr_invoke_method_arg_3(),
+                                               bench_rttr_invoke_method_arg_3_handle()};
 
     nonius::go(cfg, std::begin(benchmarks_group_6), std::end(benchmarks_group_6), reporter);
 
@@ -502,9 +630,19 @@ void bench_invoke_method()
                                               "\n"
                                               "// rttr approach\n"
                                               "m.invoke_variadic(obj, args);\n"
+                                              "\n"
+                                              "// rttr approach - argument_range\n"
+                                              "argument arg_array[] = {a1, a2, ..., a8};\n"
+                                              "m.invoke_variadic(obj, argument_range(arg_array, arg_array + 8));\n"
+                                              "\n"
+                                              "// rttr approach - typed handle\n"
+                                              "auto handle = m.bind_signature<void(Foo&, int, ..., int)>();\n"
+                                              "handle(obj, 1, 2, 3, 4, 5, 6, 7, 8);\n"
                                               "</pre>");
     nonius::benchmark benchmarks_group_7[] = { bench_native_invoke_method_arg_8(),
-                                               bench_rttr_invoke_method_arg_8()};
+                                               bench_rttr_invoke_method_arg_8(),
+                                               bench_rttr_invoke_method_arg_8_range(),
+                                               bench_rttr_invoke_method_arg_8_handle()};
 
     nonius::go(cfg, std::begin(benchmarks_group_7), std::end(benchmarks_group_7), reporter);
 
@@ -538,5 +676,43 @@ void bench_invoke_method()
 
     /////////////////////////////////////
 
+    reporter.set_current_group_name("by name - overloaded",  "benchmark code:"
+                                                             "<pre>"
+                                                             "// Foo.h\n"
+                                                             "struct Foo {\n"
+                                                             "    void method();\n"
+                                                             "    void method(int arg_1);\n"
+                                                             "    ...\n"
+                                                             "    void method(int arg_1, double arg_2);\n"
+                                                             "    void method(double arg_1, double arg_2);\n"
+                                                             "};\n"
+                                                             "\n"
+                                                             "// Setup\n"
+                                                             "Foo obj;\n"
+                                                             "rttr::type t = rttr::type::get(obj);\n"
+                                                             "// Benchmarking:\n\n"
+                                                             "// native approach\n"
+                                                             "obj.method(42, 23.0);\n"
+                                                             "\n"
+                                                             "// rttr approach\n"
+                                                             "t.invoke(\"method\", obj, {42, 23.0});\n"
+                                                             "\n"
+                                                             "// rttr approach - argument_range\n"
+                                                             "argument arg_array[] = {arg_1, arg_2};\n"
+                                                             "t.invoke(\"method\", obj, argument_range(arg_array, arg_array + 2));\n"
+                                                             "\n"
+                                                             "// rttr approach - invoke_cache\n"
+                                                             "cache.invoke(t, \"method\", obj, argument_range(arg_array, arg_array + 2));\n"
+                                                             "</pre>");
+    nonius::benchmark benchmarks_group_9[] = { bench_native_invoke_method_overloaded(),
+                                               bench_rttr_invoke_method_overloaded(),
+                                               bench_rttr_invoke_method_overloaded_range(),
+                                               bench_rttr_invoke_method_overloaded_cache()};
+
+    nonius::go(cfg, dummy_benchmark);
+    nonius::go(cfg, std::begin(benchmarks_group_9), std::end(benchmarks_group_9), reporter);
+
+    /////////////////////////////////////
+
     reporter.generate_report();
 }
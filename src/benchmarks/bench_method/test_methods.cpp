@@ -48,6 +48,17 @@ RTTR_REGISTRATION
         .method("method_ptr_arg",       &ns_foo::method_class::method_ptr_arg)
         ;
 
+    registration::class_<ns_foo::method_class_overloaded>("ns_foo::method_class_overloaded")
+        .method("overloaded_method", select_overload<void()>(&ns_foo::method_class_overloaded::overloaded_method))
+        .method("overloaded_method", select_overload<void(int)>(&ns_foo::method_class_overloaded::overloaded_method))
+        .method("overloaded_method", select_overload<void(bool)>(&ns_foo::method_class_overloaded::overloaded_method))
+        .method("overloaded_method", select_overload<void(double)>(&ns_foo::method_class_overloaded::overloaded_method))
+        .method("overloaded_method", select_overload<void(const std::string&)>(&ns_foo::method_class_overloaded::overloaded_method))
+        .method("overloaded_method", select_overload<void(int, int)>(&ns_foo::method_class_overloaded::overloaded_method))
+        .method("overloaded_method", select_overload<void(int, double)>(&ns_foo::method_class_overloaded::overloaded_method))
+        .method("overloaded_method", select_overload<void(double, double)>(&ns_foo::method_class_overloaded::overloaded_method))
+        ;
+
 
     CLASS_REGISTER(method_class_d_1, 1)
     CLASS_REGISTER(method_class_d_2, 2)
@@ -186,4 +197,62 @@ void method_class::method_ptr_arg(int* ptr)
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+void method_class_overloaded::overloaded_method()
+{
+    value_1 = 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void method_class_overloaded::overloaded_method(int arg_1)
+{
+    value_1 = arg_1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void method_class_overloaded::overloaded_method(bool arg_1)
+{
+    value_1 = arg_1 ? 1 : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void method_class_overloaded::overloaded_method(double arg_1)
+{
+    value_2 = arg_1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void method_class_overloaded::overloaded_method(const std::string& arg_1)
+{
+    value_1 = static_cast<int>(arg_1.size());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void method_class_overloaded::overloaded_method(int arg_1, int arg_2)
+{
+    value_1 = arg_1;
+    value_2 = arg_2;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void method_class_overloaded::overloaded_method(int arg_1, double arg_2)
+{
+    value_1 = arg_1;
+    value_2 = arg_2;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void method_class_overloaded::overloaded_method(double arg_1, double arg_2)
+{
+    value_2 = arg_1 + arg_2;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 }
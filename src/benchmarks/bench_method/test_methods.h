@@ -76,6 +76,21 @@ struct method_class
     RTTR_ENABLE()
 };
 
+struct method_class_overloaded
+{
+    void overloaded_method();
+    void overloaded_method(int arg_1);
+    void overloaded_method(bool arg_1);
+    void overloaded_method(double arg_1);
+    void overloaded_method(const std::string& arg_1);
+    void overloaded_method(int arg_1, int arg_2);
+    void overloaded_method(int arg_1, double arg_2);
+    void overloaded_method(double arg_1, double arg_2);
+
+    int value_1 = 0;
+    double value_2 = 0.0;
+};
+
 struct method_class_d_1 : method_class
 {
 
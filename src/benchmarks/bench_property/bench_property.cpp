@@ -0,0 +1,177 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+#include <rttr/registration>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+template<std::size_t N>
+struct property_class
+{
+    int value = 42;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<std::string>& get_property_names()
+{
+    // the names have to stay valid, because the registered properties refer only to them
+    static std::vector<std::string> names;
+    if (names.empty())
+    {
+        names.reserve(512);
+        for (int i = 0; i < 512; ++i)
+            names.push_back("property_" + std::to_string(i));
+    }
+    return names;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t N>
+static void register_property_class(string_view name)
+{
+    auto& names = get_property_names();
+    registration::class_<property_class<N>> item(name);
+    for (std::size_t i = 0; i < N; ++i)
+        item.property(names[i], &property_class<N>::value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    register_property_class<8>("property_class_8");
+    register_property_class<64>("property_class_64");
+    register_property_class<512>("property_class_512");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t N>
+nonius::benchmark bench_linear_find_property()
+{
+    return nonius::benchmark("linear scan", [](nonius::chronometer meter)
+    {
+        const type t = type::get<property_class<N>>();
+        const string_view name = get_property_names()[N - 1];
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            auto range = t.get_properties(filter_item::instance_item | filter_item::static_item |
+                                          filter_item::public_access | filter_item::non_public_access);
+            auto itr = std::find_if(range.begin(), range.end(), [name](const property& prop) { return (prop.get_name() == name); });
+            if (itr != range.end())
+            {
+                value = 1;
+            }
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t N>
+nonius::benchmark bench_rttr_find_property()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        const type t = type::get<property_class<N>>();
+        const string_view name = get_property_names()[N - 1];
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            if (t.get_property(name))
+            {
+                value = 1;
+            }
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t N>
+static void bench_find_property_group(nonius::configuration& cfg, nonius::html_group_reporter& reporter,
+                                      const std::string& suffix = std::string())
+{
+    const std::string count = std::to_string(N);
+    reporter.set_current_group_name(count + " properties" + suffix, "benchmark code:"
+                                                           "<pre>"
+                                                           "struct property_class { int value; };\n"
+                                                           "// registered with " + count + " properties: \"property_0\" ... \"property_" + std::to_string(N - 1) + "\"\n"
+                                                           "\n"
+                                                           "// linear scan approach\n"
+                                                           "auto range = t.get_properties(filter);\n"
+                                                           "if (std::find_if(range.begin(), range.end(), equal_name) != range.end())\n"
+                                                           "    return true;\n"
+                                                           "\n"
+                                                           "// rttr approach\n"
+                                                           "if (t.get_property(\"property_" + std::to_string(N - 1) + "\"))\n"
+                                                           "    return true;\n"
+                                                           "</pre>");
+
+    nonius::benchmark benchmarks[] = { bench_linear_find_property<N>(),
+                                       bench_rttr_find_property<N>()};
+
+    nonius::go(cfg, std::begin(benchmarks), std::end(benchmarks), reporter);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_property()
+{
+    nonius::configuration cfg;
+    cfg.title = "find property";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_find_property.html");
+
+    bench_find_property_group<8>(cfg, reporter);
+    bench_find_property_group<64>(cfg, reporter);
+    bench_find_property_group<512>(cfg, reporter);
+
+    registration::seal();
+
+    bench_find_property_group<8>(cfg, reporter, " - sealed");
+    bench_find_property_group<64>(cfg, reporter, " - sealed");
+    bench_find_property_group<512>(cfg, reporter, " - sealed");
+
+    reporter.generate_report();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
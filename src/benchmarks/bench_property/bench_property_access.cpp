@@ -0,0 +1,206 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/type>
+#include <rttr/registration>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+struct particle
+{
+    float x = 1.0f;
+
+    float get_speed() const { return m_speed; }
+    void set_speed(float speed) { m_speed = speed; }
+
+    float m_speed = 2.0f;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<particle>("particle")
+        .property("x", &particle::x)
+        .property("speed", &particle::get_speed, &particle::set_speed);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<particle>& get_particles()
+{
+    static std::vector<particle> particles(1000);
+    return particles;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_member_access()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        auto& particles = get_particles();
+        meter.measure([&]()
+        {
+            for (auto& p : particles)
+                p.x = p.x + 1.0f;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_member_access()
+{
+    return nonius::benchmark("rttr - get_value/set_value", [](nonius::chronometer meter)
+    {
+        auto& particles = get_particles();
+        const property prop = type::get<particle>().get_property("x");
+        meter.measure([&]()
+        {
+            for (auto& p : particles)
+                prop.set_value(p, prop.get_value(p).get_value<float>() + 1.0f);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_accessor_member_access()
+{
+    return nonius::benchmark("rttr - typed accessor", [](nonius::chronometer meter)
+    {
+        auto& particles = get_particles();
+        const auto accessor = type::get<particle>().get_property("x").get_accessor<particle, float>();
+        meter.measure([&]()
+        {
+            for (auto& p : particles)
+                accessor.set(p, accessor.get(p) + 1.0f);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_getter_access()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        auto& particles = get_particles();
+        meter.measure([&]()
+        {
+            for (auto& p : particles)
+                p.set_speed(p.get_speed() + 1.0f);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_getter_access()
+{
+    return nonius::benchmark("rttr - get_value/set_value", [](nonius::chronometer meter)
+    {
+        auto& particles = get_particles();
+        const property prop = type::get<particle>().get_property("speed");
+        meter.measure([&]()
+        {
+            for (auto& p : particles)
+                prop.set_value(p, prop.get_value(p).get_value<float>() + 1.0f);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_accessor_getter_access()
+{
+    return nonius::benchmark("rttr - typed accessor", [](nonius::chronometer meter)
+    {
+        auto& particles = get_particles();
+        const auto accessor = type::get<particle>().get_property("speed").get_accessor<particle, float>();
+        meter.measure([&]()
+        {
+            for (auto& p : particles)
+                accessor.set(p, accessor.get(p) + 1.0f);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_property_access()
+{
+    nonius::configuration cfg;
+    cfg.title = "property access";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_property_access.html");
+
+    {
+        reporter.set_current_group_name("member object", "benchmark code:"
+                                                         "<pre>"
+                                                         "struct particle { float x; };\n"
+                                                         "// for 1000 particles:\n"
+                                                         "prop.set_value(p, prop.get_value(p).get_value&lt;float&gt;() + 1.0f);\n"
+                                                         "accessor.set(p, accessor.get(p) + 1.0f);\n"
+                                                         "</pre>");
+
+        nonius::benchmark benchmarks[] = { bench_native_member_access(),
+                                           bench_rttr_member_access(),
+                                           bench_accessor_member_access() };
+
+        nonius::go(cfg, std::begin(benchmarks), std::end(benchmarks), reporter);
+    }
+
+    {
+        reporter.set_current_group_name("getter/setter", "benchmark code:"
+                                                         "<pre>"
+                                                         "struct particle { float get_speed() const; void set_speed(float); };\n"
+                                                         "// for 1000 particles:\n"
+                                                         "prop.set_value(p, prop.get_value(p).get_value&lt;float&gt;() + 1.0f);\n"
+                                                         "accessor.set(p, accessor.get(p) + 1.0f);\n"
+                                                         "</pre>");
+
+        nonius::benchmark benchmarks[] = { bench_native_getter_access(),
+                                           bench_rttr_getter_access(),
+                                           bench_accessor_getter_access() };
+
+        nonius::go(cfg, std::begin(benchmarks), std::end(benchmarks), reporter);
+    }
+
+    reporter.generate_report();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
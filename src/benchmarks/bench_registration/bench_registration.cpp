@@ -0,0 +1,200 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+#include <rttr/registration>
+#include <rttr/detail/misc/flat_map.h>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::vector<std::string>& get_type_names()
+{
+    static std::vector<std::string> names;
+    if (names.empty())
+    {
+        names.reserve(50000);
+        for (int i = 0; i < 50000; ++i)
+            names.push_back("synthetic_type<" + std::to_string(i) + ">");
+    }
+    return names;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Registers \p count type names into the same container, which is used by the type registry.
+ * Outside of a RTTR_REGISTRATION block every name is sorted in directly,
+ * inside the block the names are sorted once, at the end of the block.
+ */
+static std::size_t register_type_names(std::size_t count, bool bulk_insert)
+{
+    const auto& names = get_type_names();
+    detail::flat_map<string_view, std::size_t> name_to_id;
+
+    if (bulk_insert)
+        name_to_id.begin_bulk_insert();
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const string_view name = names[i];
+        if (name_to_id.find(name) == name_to_id.end())
+            name_to_id.insert(std::make_pair(name, i));
+    }
+
+    if (bulk_insert)
+        name_to_id.end_bulk_insert();
+
+    return name_to_id.value_data().size();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static nonius::benchmark bench_register_types(std::size_t count, bool bulk_insert)
+{
+    return nonius::benchmark(bulk_insert ? "bulk insert" : "single insert", [count, bulk_insert](nonius::chronometer meter)
+    {
+        get_type_names();
+        meter.measure([&]()
+        {
+            return register_type_names(count, bulk_insert);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::size_t class_block_size = 32;
+static const std::size_t class_block_count = 32;
+static const std::size_t class_count = class_block_size * class_block_count;
+
+template<int Group, std::size_t Block, std::size_t Index>
+struct named_class
+{
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::vector<std::string>& get_class_names()
+{
+    static std::vector<std::string> names;
+    if (names.empty())
+    {
+        names.reserve(class_count * 2);
+        for (std::size_t i = 0; i < class_count * 2; ++i)
+            names.push_back("named_class_" + std::to_string(i));
+    }
+    return names;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<int Group, std::size_t Block, std::size_t... Index>
+static void register_class_block(detail::index_sequence<Index...>)
+{
+    const auto& names = get_class_names();
+    using expander = int[];
+    (void)expander{0, (registration::class_<named_class<Group, Block, Index>>(names[Group * class_count + Block * class_block_size + Index]), 0)...};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<int Group, std::size_t... Block>
+static void register_classes(detail::index_sequence<Block...>)
+{
+    using expander = int[];
+    (void)expander{0, (register_class_block<Group, Block>(detail::make_index_sequence<class_block_size>()), 0)...};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Registers 'class_count' classes with a custom name, like a RTTR_REGISTRATION block does.
+ * A class can be registered only once, so the registration of every group is measured only one time.
+ */
+template<int Group>
+static double measure_class_registration(bool bulk_registration)
+{
+    get_class_names();
+    const auto start = std::chrono::high_resolution_clock::now();
+    if (bulk_registration)
+    {
+        // this is the scope of a RTTR_REGISTRATION block
+        detail::bulk_registration bulk_reg;
+        register_classes<Group>(detail::make_index_sequence<class_block_count>());
+    }
+    else
+    {
+        register_classes<Group>(detail::make_index_sequence<class_block_count>());
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void bench_class_registration()
+{
+    std::cout << "registration of " << class_count << " named classes" << std::endl;
+    std::cout << "  single registration: " << measure_class_registration<0>(false) << " ms" << std::endl;
+    std::cout << "  bulk registration:   " << measure_class_registration<1>(true) << " ms" << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_registration()
+{
+    bench_class_registration();
+
+    nonius::configuration cfg;
+    cfg.title = "type registration";
+    cfg.samples = 10;
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_registration.html");
+
+    reporter.set_current_group_name("10000 types", "Registration of 10000 type names,<br>the name of every type is checked for a previous registration.");
+    nonius::benchmark benchmarks_group_1[] = { bench_register_types(10000, false), bench_register_types(10000, true) };
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    reporter.set_current_group_name("50000 types", "Registration of 50000 type names,<br>the name of every type is checked for a previous registration.");
+    nonius::benchmark benchmarks_group_2[] = { bench_register_types(50000, false), bench_register_types(50000, true) };
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    reporter.generate_report();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
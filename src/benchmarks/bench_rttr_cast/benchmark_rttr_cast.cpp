@@ -212,6 +212,45 @@ bench_data<ClassMultiple6A> setup_cross_cast_class_hierachy_2()
     return bench_data<ClassMultiple6A>{std::move(vec)};
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bench_data<ClassDeepBase> setup_level_10()
+{
+    std::vector<std::shared_ptr<ClassDeepBase> > vec;
+    vec.reserve(ITEM_COUNT * 2);
+    for (int i = 0; i < ITEM_COUNT; ++i)
+    {
+        vec.push_back(detail::make_unique<ClassDeep10>());
+        vec.push_back(detail::make_unique<ClassDeep5>());
+    }
+
+    return bench_data<ClassDeepBase>{std::move(vec)};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void add_wide_classes(std::vector<std::shared_ptr<ClassWideBase> >& vec, std::integral_constant<int, WIDE_CLASS_COUNT>)
+{
+}
+
+template<int N>
+static void add_wide_classes(std::vector<std::shared_ptr<ClassWideBase> >& vec, std::integral_constant<int, N>)
+{
+    vec.push_back(detail::make_unique<ClassWide<N>>());
+    add_wide_classes(vec, std::integral_constant<int, N + 1>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bench_data<ClassWideBase> setup_wide_class_hierachy()
+{
+    std::vector<std::shared_ptr<ClassWideBase> > vec;
+    vec.reserve(WIDE_CLASS_COUNT);
+    add_wide_classes(vec, std::integral_constant<int, 0>());
+
+    return bench_data<ClassWideBase>{std::move(vec)};
+}
+
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -779,6 +818,156 @@ nonius::benchmark bench_cross_cast_rttr_cast_2()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_level_10_dynamic_cast()
+{
+    return nonius::benchmark("dynamic_cast", [](nonius::chronometer meter)
+    {
+        auto bench_data = setup_level_10();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (ClassDeep10* item = dynamic_cast<ClassDeep10*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+                else if (ClassDeep5* item = dynamic_cast<ClassDeep5*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_level_10_rttr_cast()
+{
+    return nonius::benchmark("rttr_cast", [](nonius::chronometer meter)
+    {
+        auto bench_data = setup_level_10();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (ClassDeep10* item = rttr_cast<ClassDeep10*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+                else if (ClassDeep5* item = rttr_cast<ClassDeep5*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_wide_dynamic_cast()
+{
+    return nonius::benchmark("dynamic_cast", [](nonius::chronometer meter)
+    {
+        auto bench_data = setup_wide_class_hierachy();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (auto item = dynamic_cast<ClassWide<WIDE_CLASS_COUNT - 1>*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_wide_rttr_cast()
+{
+    return nonius::benchmark("rttr_cast", [](nonius::chronometer meter)
+    {
+        auto bench_data = setup_wide_class_hierachy();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (auto item = rttr_cast<ClassWide<WIDE_CLASS_COUNT - 1>*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_wide_is_base_of()
+{
+    return nonius::benchmark("type::is_base_of", [](nonius::chronometer meter)
+    {
+        auto bench_data = setup_wide_class_hierachy();
+        const type base_type = type::get<ClassWideBase>();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (base_type.is_base_of(type::get(*bench_data.m_vec[i])))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_deep_is_derived_from()
+{
+    return nonius::benchmark("type::is_derived_from", [](nonius::chronometer meter)
+    {
+        auto bench_data = setup_level_10();
+        const type base_type = type::get<ClassDeep1>();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (type::get(*bench_data.m_vec[i]).is_derived_from(base_type))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -917,6 +1106,20 @@ void start_rttr_cast_benchmark()
     nonius::benchmark benchmarks_group_9[] = { bench_cross_cast_dynamic_cast_2(), bench_cross_cast_rttr_cast_2() };
     nonius::go(cfg, std::begin(benchmarks_group_9), std::end(benchmarks_group_9), reporter);
 
+    /////////////////////////////////////////////////////////////////////////////////////////
+
+    reporter.set_current_group_name("downcast to level 10", "A cast from the base class ten and five hierarchy levels down.");
+    nonius::benchmark benchmarks_group_10[] = { bench_level_10_dynamic_cast(), bench_level_10_rttr_cast() };
+    nonius::go(cfg, std::begin(benchmarks_group_10), std::end(benchmarks_group_10), reporter);
+
+    reporter.set_current_group_name("wide hierarchy", "A cast from the base class to one out of 200 directly derived classes.");
+    nonius::benchmark benchmarks_group_11[] = { bench_wide_dynamic_cast(), bench_wide_rttr_cast() };
+    nonius::go(cfg, std::begin(benchmarks_group_11), std::end(benchmarks_group_11), reporter);
+
+    reporter.set_current_group_name("subtype check", "Checks the inheritance relation in a 200 classes wide<br>and in a 11 levels deep hierarchy.");
+    nonius::benchmark benchmarks_group_12[] = { bench_wide_is_base_of(), bench_deep_is_derived_from() };
+    nonius::go(cfg, std::begin(benchmarks_group_12), std::end(benchmarks_group_12), reporter);
+
     reporter.generate_report();
 }
 
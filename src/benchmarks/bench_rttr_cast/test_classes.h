@@ -160,4 +160,33 @@ CLASS_INHERIT(ClassDiamondRight6, ClassDiamondRight5)
 
 CLASS_MULTI_INHERIT_3(ClassDiamondFinal, ClassDiamondLeft5, ClassDiamondMiddle5, ClassDiamondRight5)
 
+/////////////////////////////////////////////////////////////////////////////////////////
+// The following class structure has 11 hierarchy levels and is 1 class wide;
+// only single inheritance
+/////////////////////////////////////////////////////////////////////////////////////////
+
+CLASS(ClassDeepBase)
+CLASS_INHERIT(ClassDeep1, ClassDeepBase)
+CLASS_INHERIT(ClassDeep2, ClassDeep1)
+CLASS_INHERIT(ClassDeep3, ClassDeep2)
+CLASS_INHERIT(ClassDeep4, ClassDeep3)
+CLASS_INHERIT(ClassDeep5, ClassDeep4)
+CLASS_INHERIT(ClassDeep6, ClassDeep5)
+CLASS_INHERIT(ClassDeep7, ClassDeep6)
+CLASS_INHERIT(ClassDeep8, ClassDeep7)
+CLASS_INHERIT(ClassDeep9, ClassDeep8)
+CLASS_INHERIT(ClassDeep10, ClassDeep9)
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// The following class structure has 2 hierarchy levels and is 200 classes wide;
+// every class 'ClassWide<N>' is directly derived from 'ClassWideBase'
+/////////////////////////////////////////////////////////////////////////////////////////
+
+#define WIDE_CLASS_COUNT 200
+
+CLASS(ClassWideBase)
+
+template<int N>
+struct ClassWide : ClassWideBase { virtual int getType() { return N; } RTTR_ENABLE(ClassWideBase) double dummyDoubleValue; };
+
 #endif // RTTR_TESTCLASSES_H_
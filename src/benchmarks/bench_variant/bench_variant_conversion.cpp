@@ -32,6 +32,11 @@
 #include <nonius/html_group_reporter.h>
 
 #include <locale>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+#include <vector>
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -175,6 +180,23 @@ nonius::benchmark bench_native_float_to_string()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+nonius::benchmark bench_stringstream_float_to_string()
+{
+    return nonius::benchmark("std::stringstream", [](nonius::chronometer meter)
+    {
+        float var = setup_float();
+        std::string result;
+        meter.measure([&]()
+        {
+            std::stringstream ss;
+            ss << std::setprecision(std::numeric_limits<float>::digits10) << var;
+            result = ss.str();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 nonius::benchmark bench_variant_float_to_string()
 {
     return nonius::benchmark("rttr::variant", [](nonius::chronometer meter)
@@ -239,6 +261,23 @@ nonius::benchmark bench_native_double_to_string()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+nonius::benchmark bench_stringstream_double_to_string()
+{
+    return nonius::benchmark("std::stringstream", [](nonius::chronometer meter)
+    {
+        double var = setup_double();
+        std::string result;
+        meter.measure([&]()
+        {
+            std::stringstream ss;
+            ss << std::setprecision(std::numeric_limits<double>::digits10) << var;
+            result = ss.str();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 nonius::benchmark bench_variant_double_to_string()
 {
     return nonius::benchmark("rttr::variant", [](nonius::chronometer meter)
@@ -361,6 +400,250 @@ nonius::benchmark bench_variant_string_to_bool()
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
+struct custom_id
+{
+    int value;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::string custom_id_to_string(const custom_id& id, bool& ok)
+{
+    ok = true;
+    return std::to_string(id.value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static custom_id setup_custom_id()
+{
+    static bool registered = false;
+    if (!registered)
+    {
+        rttr::type::register_converter_func(custom_id_to_string);
+        rttr::type::register_converter_func([](const custom_id& id, bool& ok) { ok = true; return id.value; });
+        registered = true;
+    }
+
+    return custom_id{12345};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_custom_to_string()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        custom_id var = setup_custom_id();
+        std::string result;
+        meter.measure([&]()
+        {
+            bool ok = false;
+            result = custom_id_to_string(var, ok);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_custom_to_string()
+{
+    return nonius::benchmark("rttr::variant", [](nonius::chronometer meter)
+    {
+        rttr::variant var = setup_custom_id();
+        std::string result;
+        meter.measure([&]()
+        {
+            result = var.convert<std::string>();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_custom_to_int()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        custom_id var = setup_custom_id();
+        int result = 0;
+        meter.measure([&]()
+        {
+            result = var.value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_custom_to_int()
+{
+    return nonius::benchmark("rttr::variant", [](nonius::chronometer meter)
+    {
+        rttr::variant var = setup_custom_id();
+        int result = 0;
+        meter.measure([&]()
+        {
+            result = var.convert<int>();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<rttr::variant> setup_builtin_values()
+{
+    return { true, 'A', int8_t(12), int16_t(12), int32_t(12), int64_t(12),
+             uint8_t(12), uint16_t(12), uint32_t(12), uint64_t(12),
+             12.0f, 12.0, std::string("12") };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<rttr::type> setup_builtin_types()
+{
+    std::vector<rttr::type> result;
+    for (const auto& value : setup_builtin_values())
+        result.push_back(value.get_type());
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_builtin_can_convert()
+{
+    return nonius::benchmark("rttr::variant::can_convert()", [](nonius::chronometer meter)
+    {
+        const auto values = setup_builtin_values();
+        const auto types = setup_builtin_types();
+        meter.measure([&]()
+        {
+            int result = 0;
+            for (const auto& value : values)
+            {
+                for (const auto& target_type : types)
+                    result += value.can_convert(target_type);
+            }
+            return result;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_builtin_convert()
+{
+    return nonius::benchmark("rttr::variant::convert()", [](nonius::chronometer meter)
+    {
+        const auto values = setup_builtin_values();
+        const auto types = setup_builtin_types();
+        meter.measure([&]()
+        {
+            int result = 0;
+            for (const auto& value : values)
+            {
+                for (const auto& target_type : types)
+                {
+                    rttr::variant var = value;
+                    result += var.convert(target_type);
+                }
+            }
+            return result;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<rttr::variant> setup_number_range()
+{
+    // two blocks of different types, like the property values of two kinds of objects
+    std::vector<rttr::variant> result;
+    for (int i = 0; i < 5000; ++i)
+        result.emplace_back(i);
+    for (int i = 0; i < 5000; ++i)
+        result.emplace_back(static_cast<float>(i) * 0.5f);
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_convert_each_to_double()
+{
+    return nonius::benchmark("rttr::variant::convert<double>()", [](nonius::chronometer meter)
+    {
+        const auto values = setup_number_range();
+        std::vector<double> result(values.size());
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < values.size(); ++i)
+                result[i] = values[i].convert<double>();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_convert_range_to_double()
+{
+    return nonius::benchmark("rttr::convert_range()", [](nonius::chronometer meter)
+    {
+        const auto values = setup_number_range();
+        std::vector<double> result(values.size());
+        meter.measure([&]()
+        {
+            return rttr::convert_range(values.data(), values.data() + values.size(), result.data());
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_sort_numbers()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        const auto values = setup_number_range();
+        std::vector<double> numbers;
+        for (const auto& var : values)
+            numbers.push_back(var.to_double());
+
+        std::reverse(numbers.begin(), numbers.end());
+        meter.measure([&]()
+        {
+            auto result = numbers;
+            std::sort(result.begin(), result.end());
+            return result.size();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_sort_numbers()
+{
+    return nonius::benchmark("rttr::variant::operator<()", [](nonius::chronometer meter)
+    {
+        auto values = setup_number_range();
+        std::reverse(values.begin(), values.end());
+        meter.measure([&]()
+        {
+            auto result = values;
+            std::sort(result.begin(), result.end());
+            return result.size();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void bench_variant_conversion()
 {
     nonius::configuration cfg;
@@ -393,8 +676,9 @@ void bench_variant_conversion()
 
     reporter.set_current_group_name("float to string", "Converts a floating point number to a <code>std::string</code>:<br><pre>rttr::variant var = 123.12345f;\nvar.to_string();</pre>");
 
-    nonius::benchmark benchmarks_group_3[] = { bench_native_string_to_float(),
-                                               bench_variant_string_to_float()
+    nonius::benchmark benchmarks_group_3[] = { bench_native_float_to_string(),
+                                               bench_stringstream_float_to_string(),
+                                               bench_variant_float_to_string()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
@@ -403,8 +687,8 @@ void bench_variant_conversion()
 
     reporter.set_current_group_name("string to float", "Converts a <code>std::string</code> to a floating point number:<br><pre>rttr::variant var = std::string(\"123.12345\");\nvar.to_float().");
 
-    nonius::benchmark benchmarks_group_4[] = { bench_native_float_to_string(),
-                                               bench_variant_float_to_string()
+    nonius::benchmark benchmarks_group_4[] = { bench_native_string_to_float(),
+                                               bench_variant_string_to_float()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_4), std::end(benchmarks_group_4), reporter);
@@ -413,8 +697,9 @@ void bench_variant_conversion()
 
     reporter.set_current_group_name("double to string", "Converts a double number to a <code>std::string</code>:<br><pre>rttr::variant var = 123456.123456;\nvar.to_string();</pre>");
 
-    nonius::benchmark benchmarks_group_5[] = { bench_native_string_to_double(),
-                                               bench_variant_string_to_double()
+    nonius::benchmark benchmarks_group_5[] = { bench_native_double_to_string(),
+                                               bench_stringstream_double_to_string(),
+                                               bench_variant_double_to_string()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_5), std::end(benchmarks_group_5), reporter);
@@ -423,8 +708,8 @@ void bench_variant_conversion()
 
     reporter.set_current_group_name("string to double", "Converts a <code>std::string</code> to a double number:<br><pre>rttr::variant var = std::string(\"123456.123456\");\nvar.to_double();</pre>");
 
-    nonius::benchmark benchmarks_group_6[] = { bench_native_double_to_string(),
-                                               bench_variant_double_to_string()
+    nonius::benchmark benchmarks_group_6[] = { bench_native_string_to_double(),
+                                               bench_variant_string_to_double()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_6), std::end(benchmarks_group_6), reporter);
@@ -433,8 +718,8 @@ void bench_variant_conversion()
 
     reporter.set_current_group_name("bool to string", "Converts a bool number to a <code>std::string</code>:<br><pre>rttr::variant var = 123456.123456;\nvar.to_string();</pre>");
 
-    nonius::benchmark benchmarks_group_7[] = { bench_native_string_to_bool(),
-                                               bench_variant_string_to_bool()
+    nonius::benchmark benchmarks_group_7[] = { bench_native_bool_to_string(),
+                                               bench_variant_bool_to_string()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_7), std::end(benchmarks_group_7), reporter);
@@ -443,14 +728,64 @@ void bench_variant_conversion()
 
     reporter.set_current_group_name("string to bool", "Converts a <code>std::string</code> to a bool number:<br><pre>rttr::variant var = std::string(\"123456.123456\");\nvar.to_bool();</pre>");
 
-    nonius::benchmark benchmarks_group_8[] = { bench_native_bool_to_string(),
-                                               bench_variant_bool_to_string()
+    nonius::benchmark benchmarks_group_8[] = { bench_native_string_to_bool(),
+                                               bench_variant_string_to_bool()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_8), std::end(benchmarks_group_8), reporter);
 
     //////////////////////////////////
 
+    reporter.set_current_group_name("custom type to string", "Converts a custom type with a registered converter function to a <code>std::string</code>:<br><pre>rttr::variant var = custom_id{12345};\nvar.convert&lt;std::string&gt;();</pre>");
+
+    nonius::benchmark benchmarks_group_9[] = { bench_native_custom_to_string(),
+                                               bench_variant_custom_to_string()
+                                              };
+
+    nonius::go(cfg, std::begin(benchmarks_group_9), std::end(benchmarks_group_9), reporter);
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("custom type to int", "Converts a custom type with a registered converter function to an integer:<br><pre>rttr::variant var = custom_id{12345};\nvar.convert&lt;int&gt;();</pre>");
+
+    nonius::benchmark benchmarks_group_10[] = { bench_native_custom_to_int(),
+                                                bench_variant_custom_to_int()
+                                               };
+
+    nonius::go(cfg, std::begin(benchmarks_group_10), std::end(benchmarks_group_10), reporter);
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("builtin type matrix", "Converts every built-in type (<code>bool</code>, <code>char</code>, all fixed size integers, <code>float</code>, <code>double</code> and <code>std::string</code>) to every other built-in type:<br><pre>rttr::variant var = value;\nvar.convert(target_type);</pre>");
+
+    nonius::benchmark benchmarks_group_11[] = { bench_variant_builtin_can_convert(),
+                                                bench_variant_builtin_convert()
+                                               };
+
+    nonius::go(cfg, std::begin(benchmarks_group_11), std::end(benchmarks_group_11), reporter);
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("range to double", "Converts 10000 variants holding <code>int</code> and <code>float</code> values to a <code>std::vector&lt;double&gt;</code>:<br><pre>rttr::convert_range(values.data(), values.data() + values.size(), result.data());</pre>");
+
+    nonius::benchmark benchmarks_group_12[] = { bench_variant_convert_each_to_double(),
+                                                bench_variant_convert_range_to_double()
+                                               };
+
+    nonius::go(cfg, std::begin(benchmarks_group_12), std::end(benchmarks_group_12), reporter);
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("sort mixed numbers", "Sorts 10000 variants holding <code>int</code> and <code>float</code> values:<br><pre>std::sort(values.begin(), values.end());</pre>");
+
+    nonius::benchmark benchmarks_group_13[] = { bench_native_sort_numbers(),
+                                                bench_variant_sort_numbers()
+                                               };
+
+    nonius::go(cfg, std::begin(benchmarks_group_13), std::end(benchmarks_group_13), reporter);
+
+    //////////////////////////////////
+
     reporter.generate_report();
 }
 
@@ -32,6 +32,12 @@
 #include <nonius/nonius.h++>
 #include <nonius/html_group_reporter.h>
 
+#include <cstdlib>
+#include <new>
+#include <iostream>
+#include <memory>
+#include <utility>
+
 struct MyCustomType
 {
     int         m_data_i;
@@ -41,6 +47,60 @@ struct MyCustomType
     std::size_t m_data_st;
 };
 
+struct vector3
+{
+    float x, y, z;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// counts the heap allocations, to show which types are placed inside the variant
+
+static std::size_t g_allocation_count = 0;
+
+void* operator new(std::size_t size)
+{
+    ++g_allocation_count;
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static void print_allocation_count(const char* name, const T& value)
+{
+    const auto count_before_ctor = g_allocation_count;
+    rttr::variant var = value;
+    const auto ctor_count = g_allocation_count - count_before_ctor;
+
+    const auto count_before_copy = g_allocation_count;
+    rttr::variant var_copy = var;
+    const auto copy_count = g_allocation_count - count_before_copy;
+
+    std::cout << name << ": " << ctor_count << " allocation(s) per construction, "
+              << copy_count << " allocation(s) per copy" << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void print_allocation_counts()
+{
+    std::cout << "rttr::variant with " << RTTR_VARIANT_STORAGE_SIZE << " bytes inline storage" << std::endl;
+    // the string values fit into the small string buffer, so only the variant itself could allocate memory
+    print_allocation_count("std::string", std::string("hello"));
+    print_allocation_count("std::pair<int, int>", std::make_pair(23, 42));
+    print_allocation_count("vector3", vector3{1.0f, 2.0f, 3.0f});
+    print_allocation_count("std::shared_ptr<int>", std::make_shared<int>(42));
+    print_allocation_count("custom", MyCustomType());
+}
+
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -156,6 +216,20 @@ nonius::benchmark bench_variant_bool_ctor()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+nonius::benchmark bench_variant_vector3_ctor()
+{
+    return nonius::benchmark("vector3", [](nonius::chronometer meter)
+    {
+        std::vector<nonius::storage_for<rttr::variant>> vec(meter.runs());
+        meter.measure([&](int i )
+        {
+           vec[i].construct(vector3{1.0f, 2.0f, 3.0f});
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 nonius::benchmark bench_variant_custom_ctor()
 {
     return nonius::benchmark("custom", [](nonius::chronometer meter)
@@ -327,8 +401,57 @@ nonius::benchmark bench_variant_custom_dtor()
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
+nonius::benchmark bench_variant_string_copy()
+{
+    return nonius::benchmark("std::string", [](nonius::chronometer meter)
+    {
+        rttr::variant var = std::string("hello");
+        std::vector<nonius::storage_for<rttr::variant>> vec(meter.runs());
+        meter.measure([&](int i )
+        {
+           vec[i].construct(var);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_vector3_copy()
+{
+    return nonius::benchmark("vector3", [](nonius::chronometer meter)
+    {
+        rttr::variant var = vector3{1.0f, 2.0f, 3.0f};
+        std::vector<nonius::storage_for<rttr::variant>> vec(meter.runs());
+        meter.measure([&](int i )
+        {
+           vec[i].construct(var);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_custom_copy()
+{
+    return nonius::benchmark("custom", [](nonius::chronometer meter)
+    {
+        rttr::variant var = MyCustomType();
+        std::vector<nonius::storage_for<rttr::variant>> vec(meter.runs());
+        meter.measure([&](int i )
+        {
+           vec[i].construct(var);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void bench_variant_create()
 {
+    print_allocation_counts();
+
     nonius::configuration cfg;
     cfg.title = "rttr::variant creation";
 
@@ -344,6 +467,7 @@ void bench_variant_create()
                                                bench_variant_float_ctor(),
                                                bench_variant_int_ctor(),
                                                bench_variant_bool_ctor(),
+                                               bench_variant_vector3_ctor(),
                                                bench_variant_custom_ctor()};
     nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
 
@@ -359,6 +483,12 @@ void bench_variant_create()
                                                bench_variant_bool_dtor()};
     nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
 
+    reporter.set_current_group_name("copy", "The copy construction of a <code>rttr::variant</code> with automatic storage.");
+    nonius::benchmark benchmarks_group_3[] = { bench_variant_string_copy(),
+                                               bench_variant_vector3_copy(),
+                                               bench_variant_custom_copy()};
+    nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
+
     reporter.generate_report();
 }
 
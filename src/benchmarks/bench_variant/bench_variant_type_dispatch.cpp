@@ -0,0 +1,223 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/type>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// the values of a typical document, like the property values of serialized objects
+static std::vector<rttr::variant> setup_document_values()
+{
+    std::vector<rttr::variant> result;
+    for (int i = 0; i < 2000; ++i)
+    {
+        result.emplace_back(i);
+        result.emplace_back(static_cast<double>(i) * 0.25);
+        result.emplace_back(i % 2 == 0);
+        result.emplace_back(std::string("name"));
+        result.emplace_back(static_cast<float>(i));
+    }
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct native_value
+{
+    enum class kind { integer, floating, boolean, text } m_kind;
+    int64_t     m_int;
+    double      m_double;
+    std::string m_text;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_type_dispatch()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        std::vector<native_value> values;
+        for (const auto& var : setup_document_values())
+        {
+            if (var.is_type<std::string>())
+                values.push_back({native_value::kind::text, 0, 0.0, var.get_value<std::string>()});
+            else if (var.is_type<bool>())
+                values.push_back({native_value::kind::boolean, var.get_value<bool>(), 0.0, std::string()});
+            else if (var.is_type<int>())
+                values.push_back({native_value::kind::integer, var.get_value<int>(), 0.0, std::string()});
+            else
+                values.push_back({native_value::kind::floating, 0, var.to_double(), std::string()});
+        }
+
+        meter.measure([&]()
+        {
+            double sum = 0.0;
+            for (const auto& value : values)
+            {
+                switch (value.m_kind)
+                {
+                    case native_value::kind::integer:   sum += static_cast<double>(value.m_int); break;
+                    case native_value::kind::floating:  sum += value.m_double; break;
+                    case native_value::kind::boolean:   sum += value.m_int ? 1.0 : 0.0; break;
+                    case native_value::kind::text:      sum += static_cast<double>(value.m_text.size()); break;
+                }
+            }
+            return sum;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_is_type_dispatch()
+{
+    return nonius::benchmark("rttr::variant::is_type<T>()", [](nonius::chronometer meter)
+    {
+        const auto values = setup_document_values();
+        meter.measure([&]()
+        {
+            double sum = 0.0;
+            for (const auto& var : values)
+            {
+                if (var.is_type<int>())
+                    sum += static_cast<double>(var.get_value<int>());
+                else if (var.is_type<double>())
+                    sum += var.get_value<double>();
+                else if (var.is_type<float>())
+                    sum += static_cast<double>(var.get_value<float>());
+                else if (var.is_type<bool>())
+                    sum += var.get_value<bool>() ? 1.0 : 0.0;
+                else if (var.is_type<std::string>())
+                    sum += static_cast<double>(var.get_value<std::string>().size());
+            }
+            return sum;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_get_type_dispatch()
+{
+    return nonius::benchmark("rttr::variant::get_type()", [](nonius::chronometer meter)
+    {
+        const auto values = setup_document_values();
+        meter.measure([&]()
+        {
+            // the type dispatch of 'write_variant' in the json serialization example
+            double sum = 0.0;
+            for (const auto& var : values)
+            {
+                const rttr::type value_type = var.get_type();
+                const rttr::type t = value_type.is_wrapper() ? value_type.get_wrapped_type() : value_type;
+                if (t.is_arithmetic())
+                {
+                    if (t == rttr::type::get<bool>())
+                        sum += var.get_value<bool>() ? 1.0 : 0.0;
+                    else if (t == rttr::type::get<int>())
+                        sum += static_cast<double>(var.get_value<int>());
+                    else if (t == rttr::type::get<float>())
+                        sum += static_cast<double>(var.get_value<float>());
+                    else if (t == rttr::type::get<double>())
+                        sum += var.get_value<double>();
+                }
+                else if (t == rttr::type::get<std::string>())
+                {
+                    sum += static_cast<double>(var.get_value<std::string>().size());
+                }
+            }
+            return sum;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_is_valid()
+{
+    return nonius::benchmark("rttr::variant::is_valid()", [](nonius::chronometer meter)
+    {
+        const auto values = setup_document_values();
+        meter.measure([&]()
+        {
+            std::size_t count = 0;
+            for (const auto& var : values)
+            {
+                if (var.is_valid())
+                    ++count;
+            }
+            return count;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_variant_type_dispatch()
+{
+    nonius::configuration cfg;
+    cfg.title = "rttr::variant type dispatch";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_variant_type_dispatch.html");
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("type dispatch", "Visits 10000 variants holding <code>int</code>, <code>double</code>, <code>bool</code>, <code>std::string</code> and <code>float</code> values and dispatches on their type, like a serializer does:<br><pre>if (var.is_type&lt;int&gt;())\n    ...\nelse if (var.is_type&lt;double&gt;())\n    ...</pre>");
+
+    nonius::benchmark benchmarks_group_1[] = { bench_native_type_dispatch(),
+                                               bench_variant_is_type_dispatch(),
+                                               bench_variant_get_type_dispatch()
+                                              };
+
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("is valid", "Checks 10000 variants for validity:<br><pre>var.is_valid();</pre>");
+
+    nonius::benchmark benchmarks_group_2[] = { bench_variant_is_valid() };
+
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    //////////////////////////////////
+
+    reporter.generate_report();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,7 @@
 
 extern void bench_variant_create();
 extern void bench_variant_conversion();
+extern void bench_variant_type_dispatch();
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,6 +35,7 @@ int main(int argc, char** argv)
 {
     bench_variant_create();
     bench_variant_conversion();
+    bench_variant_type_dispatch();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
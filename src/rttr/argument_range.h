@@ -0,0 +1,126 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_ARGUMENT_RANGE_H_
+#define RTTR_ARGUMENT_RANGE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+#include "rttr/argument.h"
+#include "rttr/detail/misc/std_type_traits.h"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace rttr
+{
+
+/*!
+ * The \ref argument_range class is a non-owning view to a contiguous sequence of \ref argument objects.
+ *
+ * It consists only of a pointer to the first argument and the number of arguments;
+ * creating or copying an \ref argument_range will never copy the arguments or allocate memory.
+ * Use it to forward an arbitrary number of arguments to \ref method::invoke_variadic(),
+ * \ref constructor::invoke_variadic(), \ref type::create() or \ref type::invoke(),
+ * when the arguments are already stored in a contiguous memory block, e.g. an array on the stack.
+ *
+ * The referenced arguments have to outlive the \ref argument_range object, otherwise undefined behaviour will occur.
+ *
+ * Typical Usage
+ * -------------
+ *
+ * \code{.cpp}
+ *  int a = 1, b = 2, c = 3, d = 4, e = 5, f = 6, g = 7;
+ *  argument args[] = {a, b, c, d, e, f, g};
+ *
+ *  method meth = type::get<my_class>().get_method("sum");
+ *  variant result = meth.invoke_variadic(obj, args);                   // no heap allocation
+ *  result = meth.invoke_variadic(obj, argument_range(args, args + 3)); // only the first three arguments
+ * \endcode
+ *
+ * \remark There is intentionally no constructor from a pointer and a size;
+ *         a brace-enclosed list like `{0, 5}` would match it as well as `std::vector<argument>`,
+ *         which would make calls like `meth.invoke_variadic(obj, {0, 5})` ambiguous.
+ */
+class argument_range
+{
+    public:
+        using value_type = argument;
+        using size_type = std::size_t;
+        using const_iterator = const argument*;
+
+        /*!
+         * \brief Constructs an argument_range, which references all arguments of the array \p args.
+         */
+        template<std::size_t N>
+        RTTR_INLINE argument_range(const argument (&args)[N]) RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Constructs an argument_range, which references the arguments in the range [\p begin, \p end).
+         */
+        template<typename Itr, typename Tp = detail::enable_if_t<std::is_same<Itr, argument*>::value ||
+                                                                  std::is_same<Itr, const argument*>::value>>
+        RTTR_INLINE argument_range(Itr begin, Itr end) RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns an iterator to the first argument of the range.
+         */
+        RTTR_INLINE const_iterator begin() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns an iterator to the element following the last argument of the range.
+         */
+        RTTR_INLINE const_iterator end() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the number of arguments in this range.
+         */
+        RTTR_INLINE size_type size() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true when this range does not contain any argument, otherwise false.
+         */
+        RTTR_INLINE bool empty() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the argument at the given \p index.
+         *
+         * \remark No bounds checking is performed.
+         */
+        RTTR_INLINE const argument& operator[](size_type index) const RTTR_NOEXCEPT;
+
+    private:
+        const argument* m_begin;
+        size_type       m_size;
+};
+
+} // end namespace rttr
+
+#include "rttr/detail/impl/argument_range_impl.h"
+
+#endif // RTTR_ARGUMENT_RANGE_H_
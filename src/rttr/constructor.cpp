@@ -28,6 +28,7 @@
 #include "rttr/constructor.h"
 #include "rttr/detail/constructor/constructor_wrapper_base.h"
 #include "rttr/argument.h"
+#include "rttr/argument_range.h"
 
 #include <utility>
 
@@ -173,6 +174,13 @@ variant constructor::invoke(argument arg1, argument arg2, argument arg3, argumen
 /////////////////////////////////////////////////////////////////////////////////////////
 
 variant constructor::invoke_variadic(std::vector<argument> args) const
+{
+    return m_wrapper->invoke_variadic(argument_range(args.data(), args.data() + args.size()));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant constructor::invoke_variadic(argument_range args) const
 {
     return m_wrapper->invoke_variadic(args);
 }
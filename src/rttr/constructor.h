@@ -44,6 +44,7 @@ namespace rttr
 class variant;
 class type;
 class argument;
+class argument_range;
 
 namespace detail
 {
@@ -268,6 +269,22 @@ class RTTR_API constructor
          */
         variant invoke_variadic(std::vector<argument> args) const;
 
+        /*!
+         * \brief Invokes the constructor of type returned by \ref get_instanciated_type(),
+         *        using the arguments of the given range \p args.
+         *
+         * In contrast to the `std::vector` overload, the arguments are not copied.
+         *
+         * \remark The given argument type has to match **exactly** the type of the underling constructor parameter,
+         *         otherwise the constructor cannot be invoked and an invalid \ref variant object (see \ref variant::is_valid)
+         *         will be returned.
+         *
+         * \see argument_range
+         *
+         * \return An instance of the type \ref get_instanciated_type().
+         */
+        variant invoke_variadic(argument_range args) const;
+
         /*!
          * \brief Returns true if this constructor is the same like the \p other.
          *
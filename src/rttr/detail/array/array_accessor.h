@@ -34,6 +34,7 @@ namespace rttr
 {
 class type;
 class variant;
+class variant_ref;
 
 namespace detail
 {
@@ -70,6 +71,8 @@ struct array_accessor
     static variant get_value_as_ref(Array_Type& array, std::size_t index_1);
     static variant get_value_as_ref(const Array_Type& array, std::size_t index_1);
 
+    static variant_ref get_ref(const Array_Type& array, std::size_t index_1);
+
     /////////////////////////////////////////////////////////////////////////////////////////
 
     template<typename... Indices>
@@ -33,6 +33,7 @@
 #include "rttr/argument.h"
 #include "rttr/array_mapper.h"
 #include "rttr/variant.h"
+#include "rttr/variant_ref.h"
 #include "rttr/type.h"
 #include <type_traits>
 #include <cstddef>
@@ -355,6 +356,16 @@ struct array_accessor_impl<Array_Type, std::true_type>
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
+    static variant_ref get_ref(const Array_Type& obj, std::size_t index_1)
+    {
+        if (index_1 < array_mapper<Array_Type>::get_size(obj))
+            return variant_ref(array_mapper<Array_Type>::get_value(obj, index_1));
+        else
+            return variant_ref();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+
     template<typename... Indices>
     static bool set_value(Array_Type& obj, argument& arg, Indices... indices)
     {
@@ -430,6 +441,13 @@ struct array_accessor_impl<Array_Type, std::false_type>
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
+    static variant_ref get_ref(const Array_Type& obj, std::size_t index_1)
+    {
+        return variant_ref();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+
     template<typename... Indices>
     static bool set_value(Array_Type& obj, argument& arg, Indices... indices)
     {
@@ -764,6 +782,18 @@ variant array_accessor<Array_Type>::get_value_as_ref(const Array_Type& array, st
     return array_accessor_impl<Array_Type, cond>::get_value_as_ref(array, index);
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Array_Type>
+variant_ref array_accessor<Array_Type>::get_ref(const Array_Type& array, std::size_t index)
+{
+    const bool is_rank_in_range = std::integral_constant<bool, (1 <= rank<Array_Type>::value) >::value;
+    const bool is_returning_by_reference = std::is_reference<decltype(array_mapper<Array_Type>::get_value(array, index))>::value;
+    using cond = typename std::integral_constant<bool, is_rank_in_range && is_returning_by_reference>::type;
+
+    return array_accessor_impl<Array_Type, cond>::get_ref(array, index);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -165,6 +165,11 @@ class array_wrapper : public array_wrapper_base
             return array_accessor<Array_Type>::get_value_as_ref(*m_address_data, index_1);
         }
 
+        variant_ref get_ref(std::size_t index_1) const
+        {
+            return array_accessor<Array_Type>::get_ref(*m_address_data, index_1);
+        }
+
         /////////////////////////////////////////////////////////////////////////////////////////
 
         bool insert_value(std::size_t index_1, argument& arg)
@@ -29,6 +29,7 @@
 #define RTTR_ARRAY_WRAPPER_BASE_H_
 
 #include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/variant_ref.h"
 
 #include <vector>
 #include <cstddef>
@@ -77,6 +78,7 @@ class RTTR_API array_wrapper_base
         virtual variant get_value_variadic(const std::vector<std::size_t>& index_list) const { return variant(); }
 
         virtual variant get_value_as_ref(std::size_t index_1) const { return variant(); }
+        virtual variant_ref get_ref(std::size_t index_1) const { return variant_ref(); }
 
         virtual bool insert_value(std::size_t index_1, argument& arg) { return false; }
         virtual bool insert_value(std::size_t index_1, std::size_t index_2, argument& arg) { return false; }
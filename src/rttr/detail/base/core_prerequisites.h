@@ -29,6 +29,7 @@
 #define RTTR_CORE_PREREQUISITES_H_
 
 #include "rttr/detail/base/version.h"
+#include "rttr/detail/base/config.h"
 
 namespace rttr
 {
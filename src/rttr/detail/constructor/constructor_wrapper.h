@@ -152,7 +152,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
         }
 
         template<std::size_t ...I>
-        static RTTR_INLINE variant invoke_variadic_impl(const std::vector<argument>& arg_list, index_sequence<I...>)
+        static RTTR_INLINE variant invoke_variadic_impl(const argument_range& arg_list, index_sequence<I...>)
         {
             if (arg_list.size() == sizeof...(I))
                 return invoker_class::invoke(arg_list[I]...);
@@ -160,7 +160,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
                 return variant();
         }
 
-        variant invoke_variadic(std::vector<argument>& arg_list) const
+        variant invoke_variadic(const argument_range& arg_list) const
         {
             return invoke_variadic_impl(arg_list, make_index_sequence<sizeof...(Ctor_Args)>());
         }
@@ -233,7 +233,7 @@ class constructor_wrapper<ClassType, return_func, Acc_Level, Policy,
         {
             return method_accessor<F, Policy>::invoke(m_creator_func, instance(), arg1, arg2, arg3, arg4, arg5, arg6);
         }
-        variant invoke_variadic(std::vector<argument>& args) const
+        variant invoke_variadic(const argument_range& args) const
         {
             return method_accessor<F, Policy>::invoke_variadic(m_creator_func, instance(), args);
         }
@@ -329,7 +329,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
         }
 
         template<std::size_t ...I>
-        static RTTR_INLINE variant invoke_variadic_impl(const std::vector<argument>& arg_list, index_sequence<I...>)
+        static RTTR_INLINE variant invoke_variadic_impl(const argument_range& arg_list, index_sequence<I...>)
         {
             if (arg_list.size() == sizeof...(I))
                 return invoker_class::invoke(arg_list[I]...);
@@ -337,7 +337,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
                 return variant();
         }
 
-        variant invoke_variadic(std::vector<argument>& arg_list) const
+        variant invoke_variadic(const argument_range& arg_list) const
         {
             return invoke_variadic_impl(arg_list, make_index_sequence<sizeof...(Ctor_Args)>());
         }
@@ -403,7 +403,7 @@ class constructor_wrapper<ClassType, return_func, Acc_Level, Policy,
         {
             return method_accessor<F, Policy>::invoke(m_creator_func, instance(), arg1, arg2, arg3, arg4, arg5, arg6);
         }
-        variant invoke_variadic(std::vector<argument>& args) const
+        variant invoke_variadic(const argument_range& args) const
         {
             return method_accessor<F, Policy>::invoke_variadic(m_creator_func, instance(), args);
         }
@@ -203,7 +203,7 @@ variant constructor_wrapper_base::invoke(argument& arg1, argument& arg2, argumen
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-variant constructor_wrapper_base::invoke_variadic(std::vector<argument>& args) const
+variant constructor_wrapper_base::invoke_variadic(const argument_range& args) const
 {
     return variant();
 }
@@ -33,6 +33,7 @@
 #include "rttr/parameter_info.h"
 #include "rttr/access_levels.h"
 #include "rttr/array_range.h"
+#include "rttr/argument_range.h"
 #include "rttr/string_view.h"
 
 #include <string>
@@ -79,7 +80,7 @@ class RTTR_API constructor_wrapper_base
         virtual variant invoke(argument& arg1, argument& arg2, argument& arg3, argument& arg4,
                                argument& arg5, argument& arg6) const;
 
-        virtual variant invoke_variadic(std::vector<argument>& args) const;
+        virtual variant invoke_variadic(const argument_range& args) const;
     protected:
         void init() RTTR_NOEXCEPT;
     private:
@@ -125,7 +125,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy, Metadata_Co
             return invoke_with_defaults::invoke(m_def_args.m_args, arg1, arg2, arg3, arg4, arg5, arg6);
         }
 
-        variant invoke_variadic(std::vector<argument>& args) const
+        variant invoke_variadic(const argument_range& args) const
         {
             if (args.size() <= sizeof...(Ctor_Args))
                 return invoke_variadic_helper<invoke_with_defaults, index_sequence_for<Ctor_Args...>>::invoke(args, m_def_args.m_args);
@@ -205,7 +205,7 @@ class constructor_wrapper<ClassType, return_func, Acc_Level, Policy,
         {
             return invoke_with_defaults::invoke(m_creator_func, instance(), m_def_args.m_args, arg1, arg2, arg3, arg4, arg5, arg6);
         }
-        variant invoke_variadic(std::vector<argument>& args) const
+        variant invoke_variadic(const argument_range& args) const
         {
             if (args.size() <= function_traits<F>::arg_count)
                 return invoke_variadic_helper<invoke_with_defaults, arg_index_sequence>::invoke(args, m_creator_func, instance(), m_def_args.m_args);
@@ -289,7 +289,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy, Metadata_Co
             return invoke_with_defaults::invoke(m_def_args.m_args, arg1, arg2, arg3, arg4, arg5, arg6);
         }
 
-        variant invoke_variadic(std::vector<argument>& args) const
+        variant invoke_variadic(const argument_range& args) const
         {
             if (args.size() <= sizeof...(Ctor_Args))
                 return invoke_variadic_helper<invoke_with_defaults, index_sequence_for<Ctor_Args...>>::invoke(args, m_def_args.m_args);
@@ -364,7 +364,7 @@ class constructor_wrapper<ClassType, return_func, Acc_Level, Policy,
         {
             return invoke_with_defaults::invoke(m_creator_func, instance(), m_def_args.m_args, arg1, arg2, arg3, arg4, arg5, arg6);
         }
-        variant invoke_variadic(std::vector<argument>& args) const
+        variant invoke_variadic(const argument_range& args) const
         {
             if (args.size() <= function_traits<F>::arg_count)
                 return invoke_variadic_helper<invoke_with_defaults, arg_index_sequence>::invoke(args, m_creator_func, instance(), m_def_args.m_args);
@@ -0,0 +1,98 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/conversion/builtin_conversion.h"
+#include "rttr/variant.h"
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename From, typename To>
+static bool convert_builtin_type(const void* from, void* to)
+{
+    return convert_from<From>::to(*static_cast<const From*>(from), *static_cast<To*>(to));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+#define RTTR_BUILTIN_CONVERSION_ROW(From)                                                   \
+    {                                                                                       \
+        nullptr,                                                                            \
+        &convert_builtin_type<From, bool>,                                                  \
+        &convert_builtin_type<From, char>,                                                  \
+        &convert_builtin_type<From, int8_t>,                                                \
+        &convert_builtin_type<From, int16_t>,                                               \
+        &convert_builtin_type<From, int32_t>,                                               \
+        &convert_builtin_type<From, int64_t>,                                               \
+        &convert_builtin_type<From, uint8_t>,                                               \
+        &convert_builtin_type<From, uint16_t>,                                              \
+        &convert_builtin_type<From, uint32_t>,                                              \
+        &convert_builtin_type<From, uint64_t>,                                              \
+        &convert_builtin_type<From, float>,                                                 \
+        &convert_builtin_type<From, double>,                                                \
+        &convert_builtin_type<From, std::string>                                            \
+    }
+
+static RTTR_CONSTEXPR_OR_CONST std::size_t builtin_type_count = static_cast<std::size_t>(builtin_type::BUILTIN_TYPE_COUNT);
+
+// the rows are the source types, the columns the target types;
+// the order has to match the declaration order of 'builtin_type'
+static const builtin_conversion_func conversion_matrix[builtin_type_count][builtin_type_count] =
+{
+    { nullptr },
+    RTTR_BUILTIN_CONVERSION_ROW(bool),
+    RTTR_BUILTIN_CONVERSION_ROW(char),
+    RTTR_BUILTIN_CONVERSION_ROW(int8_t),
+    RTTR_BUILTIN_CONVERSION_ROW(int16_t),
+    RTTR_BUILTIN_CONVERSION_ROW(int32_t),
+    RTTR_BUILTIN_CONVERSION_ROW(int64_t),
+    RTTR_BUILTIN_CONVERSION_ROW(uint8_t),
+    RTTR_BUILTIN_CONVERSION_ROW(uint16_t),
+    RTTR_BUILTIN_CONVERSION_ROW(uint32_t),
+    RTTR_BUILTIN_CONVERSION_ROW(uint64_t),
+    RTTR_BUILTIN_CONVERSION_ROW(float),
+    RTTR_BUILTIN_CONVERSION_ROW(double),
+    RTTR_BUILTIN_CONVERSION_ROW(std::string)
+};
+
+#undef RTTR_BUILTIN_CONVERSION_ROW
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+builtin_conversion_func get_builtin_conversion(builtin_type from, builtin_type to) RTTR_NOEXCEPT
+{
+    return conversion_matrix[static_cast<std::size_t>(from)][static_cast<std::size_t>(to)];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
@@ -0,0 +1,163 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_BUILTIN_CONVERSION_H_
+#define RTTR_BUILTIN_CONVERSION_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * A small dense index for all types, which have built-in conversions to each other.
+ * It is stored in the type data of every type, all other types have the index `none`.
+ */
+enum class builtin_type : uint8_t
+{
+    none = 0,
+    boolean,
+    character,
+    int8,
+    int16,
+    int32,
+    int64,
+    uint8,
+    uint16,
+    uint32,
+    uint64,
+    float32,
+    float64,
+    string,
+
+    BUILTIN_TYPE_COUNT
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns `true`, when \p kind is `bool`, `char` or one of the fixed size integer types.
+ */
+RTTR_INLINE bool is_integral_builtin_type(builtin_type kind) RTTR_NOEXCEPT
+{
+    return (kind >= builtin_type::boolean && kind <= builtin_type::uint64);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+struct builtin_type_of : std::integral_constant<builtin_type, builtin_type::none> {};
+
+#define RTTR_REGISTER_BUILTIN_TYPE(type_name, builtin_value)                                     \
+template<>                                                                                       \
+struct builtin_type_of<type_name> : std::integral_constant<builtin_type, builtin_value> {};
+
+RTTR_REGISTER_BUILTIN_TYPE(bool,        builtin_type::boolean)
+RTTR_REGISTER_BUILTIN_TYPE(char,        builtin_type::character)
+RTTR_REGISTER_BUILTIN_TYPE(int8_t,      builtin_type::int8)
+RTTR_REGISTER_BUILTIN_TYPE(int16_t,     builtin_type::int16)
+RTTR_REGISTER_BUILTIN_TYPE(int32_t,     builtin_type::int32)
+RTTR_REGISTER_BUILTIN_TYPE(int64_t,     builtin_type::int64)
+RTTR_REGISTER_BUILTIN_TYPE(uint8_t,     builtin_type::uint8)
+RTTR_REGISTER_BUILTIN_TYPE(uint16_t,    builtin_type::uint16)
+RTTR_REGISTER_BUILTIN_TYPE(uint32_t,    builtin_type::uint32)
+RTTR_REGISTER_BUILTIN_TYPE(uint64_t,    builtin_type::uint64)
+RTTR_REGISTER_BUILTIN_TYPE(float,       builtin_type::float32)
+RTTR_REGISTER_BUILTIN_TYPE(double,      builtin_type::float64)
+RTTR_REGISTER_BUILTIN_TYPE(std::string, builtin_type::string)
+
+#undef RTTR_REGISTER_BUILTIN_TYPE
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the built-in type of the underlying type of the enumeration \p T;
+ * for every other type `builtin_type::none`.
+ */
+template<typename T, bool = std::is_enum<T>::value>
+struct underlying_builtin_type_of : std::integral_constant<builtin_type, builtin_type::none> {};
+
+template<typename T>
+struct underlying_builtin_type_of<T, true> : builtin_type_of<typename std::underlying_type<T>::type> {};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t Size, bool Is_Signed>
+struct fixed_size_integer_builtin_type : std::integral_constant<builtin_type, builtin_type::none> {};
+
+template<> struct fixed_size_integer_builtin_type<1, true>  : builtin_type_of<int8_t> {};
+template<> struct fixed_size_integer_builtin_type<2, true>  : builtin_type_of<int16_t> {};
+template<> struct fixed_size_integer_builtin_type<4, true>  : builtin_type_of<int32_t> {};
+template<> struct fixed_size_integer_builtin_type<8, true>  : builtin_type_of<int64_t> {};
+template<> struct fixed_size_integer_builtin_type<1, false> : builtin_type_of<uint8_t> {};
+template<> struct fixed_size_integer_builtin_type<2, false> : builtin_type_of<uint16_t> {};
+template<> struct fixed_size_integer_builtin_type<4, false> : builtin_type_of<uint32_t> {};
+template<> struct fixed_size_integer_builtin_type<8, false> : builtin_type_of<uint64_t> {};
+
+/*!
+ * Returns the built-in type, which has the same value representation as \p T:
+ * the built-in type of \p T itself, the one of the underlying type of an enumeration,
+ * or the fixed size integer type with the same size and signedness for every other integral type,
+ * e.g. `long long` or `wchar_t`; for all remaining types `builtin_type::none`.
+ */
+template<typename T, typename Enable = void>
+struct value_builtin_type_of : builtin_type_of<T> {};
+
+template<typename T>
+struct value_builtin_type_of<T, typename std::enable_if<std::is_enum<T>::value>::type>
+    : value_builtin_type_of<typename std::underlying_type<T>::type> {};
+
+template<typename T>
+struct value_builtin_type_of<T, typename std::enable_if<std::is_integral<T>::value &&
+                                                        builtin_type_of<T>::value == builtin_type::none>::type>
+    : fixed_size_integer_builtin_type<sizeof(T), std::is_signed<T>::value> {};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Converts the value \p from of one built-in type into the value \p to of another built-in type.
+ */
+using builtin_conversion_func = bool (*)(const void* from, void* to);
+
+/*!
+ * \brief Returns the function, which converts a value of the built-in type \p from to the built-in type \p to;
+ *        or a `nullptr`, when one of both types is `builtin_type::none`.
+ */
+RTTR_API builtin_conversion_func get_builtin_conversion(builtin_type from, builtin_type to) RTTR_NOEXCEPT;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_BUILTIN_CONVERSION_H_
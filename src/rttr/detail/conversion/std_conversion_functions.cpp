@@ -29,35 +29,540 @@
 
 #include "rttr/detail/conversion/number_conversion.h"
 
-#include <sstream>
-#include <locale>
 #include <limits>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <cmath>
 #include <algorithm>
-#include <climits>
-#include <iomanip>
 
 namespace rttr
 {
 namespace detail
 {
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+// floating point formatting
+//
+// A short representation, which reads back to the same value, is computed with the
+// Grisu2 algorithm of Florian Loitsch: "Printing Floating-Point Numbers Quickly and Accurately with Integers".
+// Grisu2 always produces a representation which reads back to the same value, and for the vast majority
+// of values it is the shortest one; in rare cases it produces one more digit than necessary.
+//
+// The Grisu2 implementation below (diy_fp up to grisu2() and the digit formatting) is derived from
+// the reference implementation of Florian Loitsch (http://florian.loitsch.com/publications, bench.tar.gz),
+// in the adaption of the JSON library of Niels Lohmann (https://github.com/nlohmann/json).
+//
+// Copyright (c) 2009 Florian Loitsch
+// Copyright (c) 2013 - 2017 Niels Lohmann <http://nlohmann.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*!
+ * A floating point number with a 64 bit significand: `f * 2^e`.
+ */
+struct diy_fp
+{
+    uint64_t f;
+    int      e;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE diy_fp diy_fp_sub(const diy_fp& x, const diy_fp& y) RTTR_NOEXCEPT
+{
+    return { x.f - y.f, x.e };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns `x * y`, the result is rounded to the upper 64 bits of the 128 bit product.
+ */
+static diy_fp diy_fp_mul(const diy_fp& x, const diy_fp& y) RTTR_NOEXCEPT
+{
+    const uint64_t x_lo = x.f & 0xFFFFFFFFu;
+    const uint64_t x_hi = x.f >> 32u;
+    const uint64_t y_lo = y.f & 0xFFFFFFFFu;
+    const uint64_t y_hi = y.f >> 32u;
+
+    const uint64_t p0 = x_lo * y_lo;
+    const uint64_t p1 = x_lo * y_hi;
+    const uint64_t p2 = x_hi * y_lo;
+    const uint64_t p3 = x_hi * y_hi;
+
+    uint64_t q = (p0 >> 32u) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+    q += uint64_t{1} << 31u; // round
+
+    return { p3 + (p1 >> 32u) + (p2 >> 32u) + (q >> 32u), x.e + y.e + 64 };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE diy_fp diy_fp_normalize(diy_fp x) RTTR_NOEXCEPT
+{
+    while ((x.f >> 63u) == 0)
+    {
+        x.f <<= 1u;
+        --x.e;
+    }
+
+    return x;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The value `v` of a floating point number and the two boundaries `m-` and `m+`,
+ * which are the midpoints between `v` and its neighbours.
+ */
+struct diy_fp_boundaries
+{
+    diy_fp w;
+    diy_fp minus;
+    diy_fp plus;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+struct float_bits;
+
+template<>
+struct float_bits<float>  { using type = uint32_t; };
+
+template<>
+struct float_bits<double> { using type = uint64_t; };
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static diy_fp_boundaries compute_boundaries(T value) RTTR_NOEXCEPT
+{
+    using bits_type = typename float_bits<T>::type;
+
+    const int precision     = std::numeric_limits<T>::digits; // including the hidden bit
+    const int bias          = std::numeric_limits<T>::max_exponent - 1 + (precision - 1);
+    const int min_exponent  = 1 - bias;
+    const uint64_t hidden_bit = uint64_t{1} << (precision - 1);
+
+    bits_type bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const uint64_t biased_exponent  = static_cast<uint64_t>(bits) >> (precision - 1);
+    const uint64_t fraction         = static_cast<uint64_t>(bits) & (hidden_bit - 1);
+
+    const diy_fp v = (biased_exponent == 0) ? diy_fp{ fraction, min_exponent }
+                                            : diy_fp{ fraction + hidden_bit, static_cast<int>(biased_exponent) - bias };
+
+    // the lower boundary is closer, when the significand is a power of two (except for the smallest normalized number)
+    const bool lower_boundary_is_closer = (fraction == 0 && biased_exponent > 1);
+    const diy_fp m_plus  = { 2 * v.f + 1, v.e - 1 };
+    const diy_fp m_minus = lower_boundary_is_closer ? diy_fp{ 4 * v.f - 1, v.e - 2 }
+                                                    : diy_fp{ 2 * v.f - 1, v.e - 1 };
+
+    const diy_fp w_plus  = diy_fp_normalize(m_plus);
+    const diy_fp w_minus = { m_minus.f << (m_minus.e - w_plus.e), w_plus.e };
+
+    return { diy_fp_normalize(v), w_minus, w_plus };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct cached_power
+{
+    uint64_t f;
+    int      e;
+    int      k;
+};
+
+static const int cached_power_alpha             = -60;
+static const int cached_power_gamma             = -32;
+static const int cached_powers_min_dec_exponent = -300;
+static const int cached_powers_dec_step         = 8;
+
+/*!
+ * Returns a normalized power of ten `c = f * 2^e = 10^-k`,
+ * so that the binary exponent of `c * w` is in the range [alpha, gamma].
+ */
+static cached_power get_cached_power(int e) RTTR_NOEXCEPT
+{
+    // the powers 10^k for k = -300, -292, ..., 324
+    static const cached_power cached_powers[] =
+    {
+        { 0xAB70FE17C79AC6CA, -1060, -300 },
+        { 0xFF77B1FCBEBCDC4F, -1034, -292 },
+        { 0xBE5691EF416BD60C, -1007, -284 },
+        { 0x8DD01FAD907FFC3C,  -980, -276 },
+        { 0xD3515C2831559A83,  -954, -268 },
+        { 0x9D71AC8FADA6C9B5,  -927, -260 },
+        { 0xEA9C227723EE8BCB,  -901, -252 },
+        { 0xAECC49914078536D,  -874, -244 },
+        { 0x823C12795DB6CE57,  -847, -236 },
+        { 0xC21094364DFB5637,  -821, -228 },
+        { 0x9096EA6F3848984F,  -794, -220 },
+        { 0xD77485CB25823AC7,  -768, -212 },
+        { 0xA086CFCD97BF97F4,  -741, -204 },
+        { 0xEF340A98172AACE5,  -715, -196 },
+        { 0xB23867FB2A35B28E,  -688, -188 },
+        { 0x84C8D4DFD2C63F3B,  -661, -180 },
+        { 0xC5DD44271AD3CDBA,  -635, -172 },
+        { 0x936B9FCEBB25C996,  -608, -164 },
+        { 0xDBAC6C247D62A584,  -582, -156 },
+        { 0xA3AB66580D5FDAF6,  -555, -148 },
+        { 0xF3E2F893DEC3F126,  -529, -140 },
+        { 0xB5B5ADA8AAFF80B8,  -502, -132 },
+        { 0x87625F056C7C4A8B,  -475, -124 },
+        { 0xC9BCFF6034C13053,  -449, -116 },
+        { 0x964E858C91BA2655,  -422, -108 },
+        { 0xDFF9772470297EBD,  -396, -100 },
+        { 0xA6DFBD9FB8E5B88F,  -369,  -92 },
+        { 0xF8A95FCF88747D94,  -343,  -84 },
+        { 0xB94470938FA89BCF,  -316,  -76 },
+        { 0x8A08F0F8BF0F156B,  -289,  -68 },
+        { 0xCDB02555653131B6,  -263,  -60 },
+        { 0x993FE2C6D07B7FAC,  -236,  -52 },
+        { 0xE45C10C42A2B3B06,  -210,  -44 },
+        { 0xAA242499697392D3,  -183,  -36 },
+        { 0xFD87B5F28300CA0E,  -157,  -28 },
+        { 0xBCE5086492111AEB,  -130,  -20 },
+        { 0x8CBCCC096F5088CC,  -103,  -12 },
+        { 0xD1B71758E219652C,   -77,   -4 },
+        { 0x9C40000000000000,   -50,    4 },
+        { 0xE8D4A51000000000,   -24,   12 },
+        { 0xAD78EBC5AC620000,     3,   20 },
+        { 0x813F3978F8940984,    30,   28 },
+        { 0xC097CE7BC90715B3,    56,   36 },
+        { 0x8F7E32CE7BEA5C70,    83,   44 },
+        { 0xD5D238A4ABE98068,   109,   52 },
+        { 0x9F4F2726179A2245,   136,   60 },
+        { 0xED63A231D4C4FB27,   162,   68 },
+        { 0xB0DE65388CC8ADA8,   189,   76 },
+        { 0x83C7088E1AAB65DB,   216,   84 },
+        { 0xC45D1DF942711D9A,   242,   92 },
+        { 0x924D692CA61BE758,   269,  100 },
+        { 0xDA01EE641A708DEA,   295,  108 },
+        { 0xA26DA3999AEF774A,   322,  116 },
+        { 0xF209787BB47D6B85,   348,  124 },
+        { 0xB454E4A179DD1877,   375,  132 },
+        { 0x865B86925B9BC5C2,   402,  140 },
+        { 0xC83553C5C8965D3D,   428,  148 },
+        { 0x952AB45CFA97A0B3,   455,  156 },
+        { 0xDE469FBD99A05FE3,   481,  164 },
+        { 0xA59BC234DB398C25,   508,  172 },
+        { 0xF6C69A72A3989F5C,   534,  180 },
+        { 0xB7DCBF5354E9BECE,   561,  188 },
+        { 0x88FCF317F22241E2,   588,  196 },
+        { 0xCC20CE9BD35C78A5,   614,  204 },
+        { 0x98165AF37B2153DF,   641,  212 },
+        { 0xE2A0B5DC971F303A,   667,  220 },
+        { 0xA8D9D1535CE3B396,   694,  228 },
+        { 0xFB9B7CD9A4A7443C,   720,  236 },
+        { 0xBB764C4CA7A44410,   747,  244 },
+        { 0x8BAB8EEFB6409C1A,   774,  252 },
+        { 0xD01FEF10A657842C,   800,  260 },
+        { 0x9B10A4E5E9913129,   827,  268 },
+        { 0xE7109BFBA19C0C9D,   853,  276 },
+        { 0xAC2820D9623BF429,   880,  284 },
+        { 0x80444B5E7AA7CF85,   907,  292 },
+        { 0xBF21E44003ACDD2D,   933,  300 },
+        { 0x8E679C2F5E44FF8F,   960,  308 },
+        { 0xD433179D9C8CB841,   986,  316 },
+        { 0x9E19DB92B4E31BA9,  1013,  324 }
+    };
+
+    const int f = cached_power_alpha - e - 1;
+    const int k = (f * 78913) / (1 << 18) + static_cast<int>(f > 0); // ceil(f * log10(2))
+
+    const int index = (-cached_powers_min_dec_exponent + k + (cached_powers_dec_step - 1)) / cached_powers_dec_step;
+    return cached_powers[index];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the number of decimal digits of \p n and sets \p pow10 to the largest power of ten <= \p n.
+ */
+static int find_largest_pow10(uint32_t n, uint32_t& pow10) RTTR_NOEXCEPT
+{
+    int digits = 10;
+    pow10 = 1000000000u;
+    while (digits > 1 && n < pow10)
+    {
+        pow10 /= 10;
+        --digits;
+    }
+
+    return digits;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void grisu2_round(char* buffer, int length, uint64_t dist, uint64_t delta,
+                         uint64_t rest, uint64_t ten_k) RTTR_NOEXCEPT
+{
+    // move the last digit towards w, as long as we stay inside the boundaries
+    while (rest < dist && delta - rest >= ten_k &&
+           (rest + ten_k < dist || dist - rest > rest + ten_k - dist))
+    {
+        --buffer[length - 1];
+        rest += ten_k;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void grisu2_digit_gen(char* buffer, int& length, int& decimal_exponent,
+                             diy_fp m_minus, diy_fp w, diy_fp m_plus) RTTR_NOEXCEPT
+{
+    uint64_t delta  = diy_fp_sub(m_plus, m_minus).f;
+    uint64_t dist   = diy_fp_sub(m_plus, w).f;
+
+    const diy_fp one = { uint64_t{1} << -m_plus.e, m_plus.e };
+
+    uint32_t p1 = static_cast<uint32_t>(m_plus.f >> -one.e);    // integral part
+    uint64_t p2 = m_plus.f & (one.f - 1);                       // fractional part
+
+    uint32_t pow10;
+    int n = find_largest_pow10(p1, pow10);
+
+    while (n > 0)
+    {
+        const uint32_t digit = p1 / pow10;
+        p1 %= pow10;
+        buffer[length++] = static_cast<char>('0' + digit);
+        --n;
+
+        const uint64_t rest = (static_cast<uint64_t>(p1) << -one.e) + p2;
+        if (rest <= delta)
+        {
+            decimal_exponent += n;
+            grisu2_round(buffer, length, dist, delta, rest, static_cast<uint64_t>(pow10) << -one.e);
+            return;
+        }
+
+        pow10 /= 10;
+    }
+
+    int m = 0;
+    for (;;)
+    {
+        p2 *= 10;
+        const uint64_t digit = p2 >> -one.e;
+        p2 &= one.f - 1;
+        buffer[length++] = static_cast<char>('0' + digit);
+        ++m;
+
+        delta *= 10;
+        dist  *= 10;
+        if (p2 <= delta)
+            break;
+    }
+
+    decimal_exponent -= m;
+    grisu2_round(buffer, length, dist, delta, p2, one.f);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
+/*!
+ * Writes the decimal digits of the positive number \p value into \p buffer,
+ * so that `digits * 10^decimal_exponent` reads back to `value`.
+ * The digits are the shortest ones for almost all values, but not guaranteed to be.
+ */
 template<typename T>
-std::string to_string_impl(T value, bool* ok)
+static void grisu2(char* buffer, int& length, int& decimal_exponent, T value) RTTR_NOEXCEPT
 {
-    try
+    const diy_fp_boundaries w = compute_boundaries(value);
+
+    const cached_power cached = get_cached_power(w.plus.e);
+    const diy_fp c_minus_k = { cached.f, cached.e };
+
+    const diy_fp v       = diy_fp_mul(w.w, c_minus_k);
+    const diy_fp v_minus = diy_fp_mul(w.minus, c_minus_k);
+    const diy_fp v_plus  = diy_fp_mul(w.plus, c_minus_k);
+
+    // the products are inexact, narrow the boundaries by one ulp to stay on the safe side
+    const diy_fp m_minus = { v_minus.f + 1, v_minus.e };
+    const diy_fp m_plus  = { v_plus.f - 1, v_plus.e };
+
+    length = 0;
+    decimal_exponent = -cached.k;
+    grisu2_digit_gen(buffer, length, decimal_exponent, m_minus, v, m_plus);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static char* append_exponent(char* buffer, int exponent) RTTR_NOEXCEPT
+{
+    if (exponent < 0)
+    {
+        exponent = -exponent;
+        *buffer++ = '-';
+    }
+    else
     {
-        std::string text = std::to_string(value);
-        if (ok)
-            *ok = true;
-        return text;
+        *buffer++ = '+';
     }
-    catch (...)
+
+    // at least two digits, like printf("%g")
+    if (exponent >= 100)
     {
-        if (ok)
-            *ok = false;
-        return std::string();
+        *buffer++ = static_cast<char>('0' + exponent / 100);
+        exponent %= 100;
     }
+
+    *buffer++ = static_cast<char>('0' + exponent / 10);
+    *buffer++ = static_cast<char>('0' + exponent % 10);
+    return buffer;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Formats the \p length digits in \p buffer with the given \p decimal_exponent,
+ * the notation is choosen in the same way as `printf("%g")` does it with a precision of \p max_exponent.
+ */
+static char* format_digits(char* buffer, int length, int decimal_exponent, int max_exponent) RTTR_NOEXCEPT
+{
+    const int k = length;
+    const int n = length + decimal_exponent; // the position of the decimal point
+
+    if (k <= n && n <= max_exponent)
+    {
+        // digits[000]
+        std::memset(buffer + k, '0', static_cast<std::size_t>(n - k));
+        return buffer + n;
+    }
+
+    if (0 < n && n <= max_exponent)
+    {
+        // dig.its
+        std::memmove(buffer + (n + 1), buffer + n, static_cast<std::size_t>(k - n));
+        buffer[n] = '.';
+        return buffer + (k + 1);
+    }
+
+    if (-4 < n && n <= 0)
+    {
+        // 0.[000]digits
+        std::memmove(buffer + (2 + -n), buffer, static_cast<std::size_t>(k));
+        buffer[0] = '0';
+        buffer[1] = '.';
+        std::memset(buffer + 2, '0', static_cast<std::size_t>(-n));
+        return buffer + (2 + (-n) + k);
+    }
+
+    // d.igitse+123
+    if (k > 1)
+    {
+        std::memmove(buffer + 2, buffer + 1, static_cast<std::size_t>(k - 1));
+        buffer[1] = '.';
+        buffer += k + 1;
+    }
+    else
+    {
+        buffer += 1;
+    }
+
+    *buffer++ = 'e';
+    return append_exponent(buffer, n - 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static std::string floating_point_to_string(T value)
+{
+    if (std::isnan(value))
+        return std::string("nan");
+
+    char buffer[64];
+    char* first = buffer;
+
+    if (std::signbit(value))
+    {
+        value = -value;
+        *first++ = '-';
+    }
+
+    if (std::isinf(value))
+    {
+        std::memcpy(first, "inf", 3);
+        return std::string(buffer, first + 3);
+    }
+
+    if (value == 0)
+    {
+        *first++ = '0';
+        return std::string(buffer, first);
+    }
+
+    int length = 0;
+    int decimal_exponent = 0;
+    grisu2(first, length, decimal_exponent, value);
+
+    char* last = format_digits(first, length, decimal_exponent, std::numeric_limits<T>::digits10);
+    return std::string(buffer, last);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+// integer formatting
+
+template<typename T>
+static std::string integer_to_string(T value)
+{
+    using unsigned_type = typename std::make_unsigned<T>::type;
+
+    char buffer[std::numeric_limits<unsigned_type>::digits10 + 2];
+    char* const last = buffer + sizeof(buffer);
+    char* first = last;
+
+    const bool is_negative = (value < 0);
+    // negate in the unsigned domain, in order to handle the minimum value correctly
+    unsigned_type number = is_negative ? unsigned_type(0) - static_cast<unsigned_type>(value) : static_cast<unsigned_type>(value);
+
+    do
+    {
+        *--first = static_cast<char>('0' + number % 10);
+        number /= 10;
+    } while (number != 0);
+
+    if (is_negative)
+        *--first = '-';
+
+    return std::string(first, last);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static RTTR_INLINE std::string to_string_impl(T value, bool* ok)
+{
+    if (ok)
+        *ok = true;
+
+    return integer_to_string(value);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -106,230 +611,555 @@ std::string to_string(unsigned long long value, bool* ok)
 
 std::string to_string(float value, bool* ok)
 {
-    try
-    {
-        std::stringstream ss;
-        ss << std::setprecision(std::numeric_limits<float>::digits10) << value;
-        if (ok)
-            *ok = true;
-        return ss.str();
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return std::string();
-    }
+    if (ok)
+        *ok = true;
+
+    return floating_point_to_string(value);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 std::string to_string(double value, bool* ok)
 {
-    try
-    {
-        std::stringstream ss;
-        ss << std::setprecision(std::numeric_limits<double>::digits10) << value;
-        if (ok)
-            *ok = true;
-        return ss.str();
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return std::string();
-    }
+    if (ok)
+        *ok = true;
+
+    return floating_point_to_string(value);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
+// parsing
 
-bool string_to_bool(std::string text, bool* ok)
+static RTTR_INLINE bool is_space(char c) RTTR_NOEXCEPT
 {
-    std::transform(text.begin(), text.end(), text.begin(), ::tolower);
-    text.erase( std::remove_if( text.begin(), text.end(), []( char ch ) { return std::isspace<char>( ch, std::locale::classic() ); } ), text.end() );
+    return (c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r');
+}
 
-    if (text == "false" || text == "0" || text.empty())
-    {
-        if (ok)
-            *ok = true;
-        return false;
-    }
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE bool is_digit(char c) RTTR_NOEXCEPT
+{
+    return (c >= '0' && c <= '9');
+}
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE char to_lower(char c) RTTR_NOEXCEPT
+{
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE bool is_hex_digit(char c) RTTR_NOEXCEPT
+{
+    return (is_digit(c) || (to_lower(c) >= 'a' && to_lower(c) <= 'f'));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static RTTR_INLINE T set_ok(bool* ok, bool value, T result)
+{
     if (ok)
-        *ok = true;
+        *ok = value;
 
-    return true;
+    return (value ? result : T(0));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-int string_to_int(const std::string& source, bool* ok)
+/*!
+ * Parses a decimal integer with leading white spaces and an optional sign; like `std::strtoll` does it.
+ * The whole \p text has to be consumed, otherwise the conversion fails.
+ */
+template<typename T>
+static bool parse_integer(string_view text, T& result) RTTR_NOEXCEPT
 {
-    try
+    const char* itr = text.data();
+    const char* const end = itr + text.size();
+
+    while (itr != end && is_space(*itr))
+        ++itr;
+
+    bool is_negative = false;
+    if (itr != end && (*itr == '+' || *itr == '-'))
     {
-        std::size_t pos = 0;
-        const int value = std::stoi(source, &pos);
-        if (pos == source.length())
-        {
-            if (ok)
-                *ok = true;
-            return value;
-        }
+        is_negative = (*itr == '-');
+        ++itr;
     }
-    catch (...)
+
+    if (itr == end)
+        return false;
+
+    uint64_t magnitude = 0;
+    for (; itr != end; ++itr)
     {
-        if (ok)
-            *ok = false;
-        return 0;
+        if (!is_digit(*itr))
+            return false;
+
+        const uint64_t digit = static_cast<uint64_t>(*itr - '0');
+        if (magnitude > (std::numeric_limits<uint64_t>::max() - digit) / 10)
+            return false; // value too large
+
+        magnitude = magnitude * 10 + digit;
     }
 
-    if (ok)
-        *ok = false;
-    return 0;
+    if (is_negative)
+    {
+        const uint64_t max_negative = std::numeric_limits<T>::is_signed ? static_cast<uint64_t>(std::numeric_limits<T>::max()) + 1 : 0;
+        if (magnitude > max_negative)
+            return false; // value too small
+
+        result = static_cast<T>(uint64_t(0) - magnitude);
+    }
+    else
+    {
+        if (magnitude > static_cast<uint64_t>(std::numeric_limits<T>::max()))
+            return false; // value too large
+
+        result = static_cast<T>(magnitude);
+    }
+
+    return true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-unsigned long string_to_ulong(const std::string& source, bool* ok)
+template<typename T>
+struct exact_float_limits;
+
+template<>
+struct exact_float_limits<float>
+{
+    static RTTR_CONSTEXPR_OR_CONST uint64_t max_mantissa  = uint64_t{1} << 24;
+    static RTTR_CONSTEXPR_OR_CONST int max_exponent       = 10;
+};
+
+template<>
+struct exact_float_limits<double>
+{
+    static RTTR_CONSTEXPR_OR_CONST uint64_t max_mantissa  = uint64_t{1} << 53;
+    static RTTR_CONSTEXPR_OR_CONST int max_exponent       = 22;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Parses simple decimal numbers, whose significand and power of ten can be represented exactly in \p T.
+ * Then a single multiplication or division yields the correctly rounded result.
+ *
+ * \return `false`, when the \p text could not be converted exactly with this fast path.
+ */
+template<typename T>
+static bool parse_float_fast(string_view text, T& result) RTTR_NOEXCEPT
 {
-    try
+    static const T powers_of_ten[] = { T(1e0),  T(1e1),  T(1e2),  T(1e3),  T(1e4),  T(1e5),
+                                       T(1e6),  T(1e7),  T(1e8),  T(1e9),  T(1e10), T(1e11),
+                                       T(1e12), T(1e13), T(1e14), T(1e15), T(1e16), T(1e17),
+                                       T(1e18), T(1e19), T(1e20), T(1e21), T(1e22) };
+
+    const char* itr = text.data();
+    const char* const end = itr + text.size();
+
+    while (itr != end && is_space(*itr))
+        ++itr;
+
+    bool is_negative = false;
+    if (itr != end && (*itr == '+' || *itr == '-'))
+    {
+        is_negative = (*itr == '-');
+        ++itr;
+    }
+
+    uint64_t mantissa = 0;
+    int exponent = 0;
+    int digit_count = 0;
+    int significant_digits = 0;
+    bool has_point = false;
+    for (; itr != end; ++itr)
     {
-        std::size_t pos = 0;
-        const long long value = std::stoll(source, &pos);
-        unsigned long result = 0;
-        if (pos == source.length() && convert_to(value, result))
+        if (is_digit(*itr))
         {
-            if (ok)
-                *ok = true;
-            return result;
+            ++digit_count;
+            if (mantissa == 0 && *itr == '0')
+            {
+                if (has_point)
+                    --exponent;
+                continue;
+            }
+
+            if (++significant_digits > 19)
+                return false;
+
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*itr - '0');
+            if (has_point)
+                --exponent;
+        }
+        else if (*itr == '.' && !has_point)
+        {
+            has_point = true;
+        }
+        else
+        {
+            break;
         }
     }
-    catch (...)
+
+    if (digit_count == 0)
+        return false;
+
+    if (itr != end && (*itr == 'e' || *itr == 'E'))
     {
-        if (ok)
-            *ok = false;
-        return 0;
+        ++itr;
+        bool is_negative_exponent = false;
+        if (itr != end && (*itr == '+' || *itr == '-'))
+        {
+            is_negative_exponent = (*itr == '-');
+            ++itr;
+        }
+
+        if (itr == end)
+            return false;
+
+        int explicit_exponent = 0;
+        for (; itr != end && is_digit(*itr); ++itr)
+        {
+            if (explicit_exponent > 1000)
+                return false;
+
+            explicit_exponent = explicit_exponent * 10 + (*itr - '0');
+        }
+
+        exponent += is_negative_exponent ? -explicit_exponent : explicit_exponent;
     }
 
-    if (ok)
-        *ok = false;
-    return 0;
+    if (itr != end)
+        return false;
+
+    if (mantissa == 0)
+        exponent = 0;
+
+    if (mantissa > exact_float_limits<T>::max_mantissa ||
+        exponent > exact_float_limits<T>::max_exponent || exponent < -exact_float_limits<T>::max_exponent)
+    {
+        return false;
+    }
+
+    T value = static_cast<T>(mantissa);
+    if (exponent < 0)
+        value /= powers_of_ten[-exponent];
+    else
+        value *= powers_of_ten[exponent];
+
+    result = is_negative ? -value : value;
+    return true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-long long string_to_long_long(const std::string& source, bool* ok)
+static RTTR_INLINE void string_to_floating_point(const char* text, char** end, float& result) { result = std::strtof(text, end); }
+static RTTR_INLINE void string_to_floating_point(const char* text, char** end, double& result) { result = std::strtod(text, end); }
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Checks whether \p text starts with \p word, ignoring the case.
+ */
+static RTTR_INLINE bool starts_with_word(string_view text, string_view word) RTTR_NOEXCEPT
 {
-    try
-    {
-        std::size_t pos = 0;
-        const long long value = std::stoll(source, &pos);
-        if (pos == source.length())
-        {
-            if (ok)
-                *ok = true;
-            return value;
-        }
-    }
-    catch (...)
+    if (text.size() < word.size())
+        return false;
+
+    for (std::size_t i = 0; i < word.size(); ++i)
     {
-        if (ok)
-            *ok = false;
-        return 0;
+        if (to_lower(text[i]) != word[i])
+            return false;
     }
 
-    if (ok)
-        *ok = false;
-    return 0;
+    return true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-unsigned long long string_to_ulong_long(const std::string& source, bool* ok)
+/*!
+ * Copies the number \p text, written in the format of the C locale, without its decimal point into \p buffer;
+ * the position of the point is moved into the exponent instead (e.g. "1.25e3" is written as "125e1").
+ * So the C library parses the number independent of the current locale,
+ * which defines the decimal point and may accept other formats.
+ *
+ * \remark \p buffer has to provide at least `text.size() + 32` characters.
+ *
+ * \return `false`, when \p text is not a floating point number in the format of the C locale.
+ */
+static bool copy_number_without_point(string_view text, char* buffer) RTTR_NOEXCEPT
 {
-    try
+    const char* itr = text.data();
+    const char* const end = itr + text.size();
+    char* out = buffer;
+
+    while (itr != end && is_space(*itr))
+        ++itr;
+
+    if (itr != end && (*itr == '+' || *itr == '-'))
+        *out++ = *itr++;
+
+    if (itr != end && !is_digit(*itr) && *itr != '.')
     {
-        std::size_t pos = 0;
-        const auto itr = std::find_if(source.begin(), source.end(), [](char c){ return !std::isdigit(c, std::locale()); });
-        if (itr == source.end())
+        // infinity or not-a-number, e.g. "inf", "INFINITY", "nan" or "nan(123)"
+        const string_view rest(itr, static_cast<std::size_t>(end - itr));
+        std::size_t length = 0;
+        if (starts_with_word(rest, "infinity"))
+        {
+            length = 8;
+        }
+        else if (starts_with_word(rest, "inf"))
         {
-            const unsigned long long value = std::stoull(source, &pos);
-            if (pos == source.length())
+            length = 3;
+        }
+        else if (starts_with_word(rest, "nan"))
+        {
+            length = 3;
+            if (length < rest.size() && rest[length] == '(')
             {
-                if (ok)
-                    *ok = true;
-                return value;
+                std::size_t index = length + 1;
+                while (index < rest.size() && (is_digit(rest[index]) || rest[index] == '_' ||
+                                               (to_lower(rest[index]) >= 'a' && to_lower(rest[index]) <= 'z')))
+                {
+                    ++index;
+                }
+
+                if (index < rest.size() && rest[index] == ')')
+                    length = index + 1;
             }
         }
+
+        if (length == 0 || length != rest.size())
+            return false;
+
+        std::memcpy(out, rest.data(), rest.size());
+        out[rest.size()] = '\0';
+        return true;
     }
-    catch (...)
+
+    const bool is_hex = (end - itr >= 2 && itr[0] == '0' && to_lower(itr[1]) == 'x');
+    if (is_hex)
     {
-        if (ok)
-            *ok = false;
-        return 0;
+        *out++ = *itr++;
+        *out++ = *itr++;
     }
 
-    if (ok)
-        *ok = false;
-    return 0;
-}
+    int64_t fraction_digits = 0;
+    int64_t digit_count = 0;
+    bool has_point = false;
+    for (; itr != end; ++itr)
+    {
+        if (is_hex ? is_hex_digit(*itr) : is_digit(*itr))
+        {
+            *out++ = *itr;
+            ++digit_count;
+            if (has_point)
+                ++fraction_digits;
+        }
+        else if (*itr == '.' && !has_point)
+        {
+            has_point = true;
+        }
+        else
+        {
+            break;
+        }
+    }
 
-/////////////////////////////////////////////////////////////////////////////////////////
+    if (digit_count == 0)
+        return false;
 
-float string_to_float(const std::string& source, bool* ok)
-{
-    try
+    int64_t exponent = 0;
+    if (itr != end && to_lower(*itr) == (is_hex ? 'p' : 'e'))
     {
-        std::size_t pos = 0;
-        const float value = std::stof(source, &pos);
-        if (pos == source.length())
+        ++itr;
+        bool is_negative_exponent = false;
+        if (itr != end && (*itr == '+' || *itr == '-'))
+        {
+            is_negative_exponent = (*itr == '-');
+            ++itr;
+        }
+
+        if (itr == end || !is_digit(*itr))
+            return false;
+
+        // a bigger exponent overflows or underflows anyway, the limit keeps space for the digits of the fraction
+        for (; itr != end && is_digit(*itr); ++itr)
         {
-            if (ok)
-                *ok = true;
-            return value;
+            if (exponent < 1000000000)
+                exponent = exponent * 10 + (*itr - '0');
         }
+
+        if (is_negative_exponent)
+            exponent = -exponent;
     }
-    catch (...)
+
+    if (itr != end)
+        return false;
+
+    // every hexadecimal digit of the fraction is four bits
+    exponent -= (is_hex ? 4 * fraction_digits : fraction_digits);
+
+    *out++ = (is_hex ? 'p' : 'e');
+    if (exponent < 0)
     {
-        if (ok)
-            *ok = false;
-        return 0;
+        *out++ = '-';
+        exponent = -exponent;
     }
 
-    if (ok)
-        *ok = false;
-    return 0;
+    char exponent_digits[24];
+    int exponent_length = 0;
+    do
+    {
+        exponent_digits[exponent_length++] = static_cast<char>('0' + exponent % 10);
+        exponent /= 10;
+    } while (exponent != 0);
+
+    while (exponent_length > 0)
+        *out++ = exponent_digits[--exponent_length];
+
+    *out = '\0';
+    return true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-double string_to_double(const std::string& source, bool* ok)
+/*!
+ * Converts the \p text with the C library. The text is validated and rewritten without a decimal point before,
+ * so the accepted format and the result do not depend on the current locale.
+ */
+template<typename T>
+static bool parse_float_slow(string_view text, T& result)
 {
-    try
+    if (text.empty())
+        return false;
+
+    char stack_buffer[160];
+    std::string heap_buffer;
+    char* buffer = stack_buffer;
+    if (text.size() + 32 > sizeof(stack_buffer))
     {
-        std::size_t pos = 0;
-        const double value = std::stod(source, &pos);
-        if (pos == source.length())
-        {
-            if (ok)
-                *ok = true;
-            return value;
-        }
+        heap_buffer.resize(text.size() + 32);
+        buffer = &heap_buffer[0];
     }
-    catch (...)
+
+    if (!copy_number_without_point(text, buffer))
+        return false;
+
+    char* last = nullptr;
+    errno = 0;
+    T value;
+    string_to_floating_point(buffer, &last, value);
+    if (last == buffer || *last != '\0')
+        return false;
+
+    // denormalized numbers are fine, an overflow or an underflow to zero is not
+    if (errno == ERANGE && (std::isinf(value) || value == T(0)))
+        return false;
+
+    result = value;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static RTTR_INLINE T string_to_floating_point_impl(string_view text, bool* ok)
+{
+    T result = T(0);
+    const bool success = (parse_float_fast(text, result) || parse_float_slow(text, result));
+    return set_ok(ok, success, result);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static RTTR_INLINE T string_to_integer_impl(string_view text, bool* ok)
+{
+    T result = T(0);
+    const bool success = parse_integer(text, result);
+    return set_ok(ok, success, result);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool string_to_bool(string_view text, bool* ok)
+{
+    // compare all characters except white spaces case insensitive with "false" and "0"
+    char buffer[6];
+    std::size_t length = 0;
+    for (const char c : text)
     {
-        if (ok)
-            *ok = false;
-        return 0;
+        if (is_space(c))
+            continue;
+
+        if (length == sizeof(buffer))
+            break;
+
+        buffer[length++] = to_lower(c);
     }
 
     if (ok)
-        *ok = false;
+        *ok = true;
+
+    const string_view value(buffer, length);
+    return !(value.empty() || value == "false" || value == "0");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+int string_to_int(string_view source, bool* ok)
+{
+    return string_to_integer_impl<int>(source, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
 
-    return 0;
+unsigned long string_to_ulong(string_view source, bool* ok)
+{
+    return string_to_integer_impl<unsigned long>(source, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+long long string_to_long_long(string_view source, bool* ok)
+{
+    return string_to_integer_impl<long long>(source, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+unsigned long long string_to_ulong_long(string_view source, bool* ok)
+{
+    // only digits are allowed, no white spaces or a sign
+    for (const char c : source)
+    {
+        if (!is_digit(c))
+            return set_ok(ok, false, 0ull);
+    }
+
+    return string_to_integer_impl<unsigned long long>(source, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+float string_to_float(string_view source, bool* ok)
+{
+    return string_to_floating_point_impl<float>(source, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+double string_to_double(string_view source, bool* ok)
+{
+    return string_to_floating_point_impl<double>(source, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
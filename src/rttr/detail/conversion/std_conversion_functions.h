@@ -29,6 +29,8 @@
 #define RTTR_STD_CONVERSION_FUNCTIONS_H_
 
 #include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/string_view.h"
+
 #include <string>
 
 namespace rttr
@@ -73,31 +75,31 @@ RTTR_API std::string to_string(double value, bool* ok);
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-RTTR_API bool string_to_bool(std::string value, bool* ok);
+RTTR_API bool string_to_bool(string_view text, bool* ok);
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-RTTR_API int string_to_int(const std::string& source, bool* ok);
+RTTR_API int string_to_int(string_view source, bool* ok);
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-RTTR_API unsigned long string_to_ulong(const std::string& source, bool* ok);
+RTTR_API unsigned long string_to_ulong(string_view source, bool* ok);
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-RTTR_API long long string_to_long_long(const std::string& source, bool* ok);
+RTTR_API long long string_to_long_long(string_view source, bool* ok);
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-RTTR_API unsigned long long string_to_ulong_long(const std::string& source, bool* ok);
+RTTR_API unsigned long long string_to_ulong_long(string_view source, bool* ok);
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-RTTR_API float string_to_float(const std::string& source, bool* ok);
+RTTR_API float string_to_float(string_view source, bool* ok);
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-RTTR_API double string_to_double(const std::string& source, bool* ok);
+RTTR_API double string_to_double(string_view source, bool* ok);
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -0,0 +1,94 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_ARGUMENT_RANGE_IMPL_H_
+#define RTTR_ARGUMENT_RANGE_IMPL_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t N>
+RTTR_INLINE argument_range::argument_range(const argument (&args)[N]) RTTR_NOEXCEPT
+:   m_begin(args),
+    m_size(N)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Itr, typename Tp>
+RTTR_INLINE argument_range::argument_range(Itr begin, Itr end) RTTR_NOEXCEPT
+:   m_begin(begin),
+    m_size(static_cast<size_type>(end - begin))
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE argument_range::const_iterator argument_range::begin() const RTTR_NOEXCEPT
+{
+    return m_begin;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE argument_range::const_iterator argument_range::end() const RTTR_NOEXCEPT
+{
+    return (m_begin + m_size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE argument_range::size_type argument_range::size() const RTTR_NOEXCEPT
+{
+    return m_size;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool argument_range::empty() const RTTR_NOEXCEPT
+{
+    return (m_size == 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE const argument& argument_range::operator[](size_type index) const RTTR_NOEXCEPT
+{
+    return m_begin[index];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
+
+#endif // RTTR_ARGUMENT_RANGE_IMPL_H_
@@ -0,0 +1,239 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_TYPED_METHOD_HANDLE_IMPL_H_
+#define RTTR_TYPED_METHOD_HANDLE_IMPL_H_
+
+#include "rttr/detail/misc/function_traits.h"
+
+#include <tuple>
+#include <type_traits>
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ReturnType, typename... Args>
+RTTR_INLINE typed_method_handle<ReturnType(Args...)>::typed_method_handle() RTTR_NOEXCEPT
+:   m_func(nullptr),
+    m_invoke(nullptr)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ReturnType, typename... Args>
+RTTR_INLINE typed_method_handle<ReturnType(Args...)>::typed_method_handle(const void* func, invoke_func invoker) RTTR_NOEXCEPT
+:   m_func(func),
+    m_invoke(invoker)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ReturnType, typename... Args>
+RTTR_INLINE bool typed_method_handle<ReturnType(Args...)>::is_valid() const RTTR_NOEXCEPT
+{
+    return (m_invoke != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ReturnType, typename... Args>
+RTTR_INLINE typed_method_handle<ReturnType(Args...)>::operator bool() const RTTR_NOEXCEPT
+{
+    return is_valid();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ReturnType, typename... Args>
+RTTR_INLINE ReturnType typed_method_handle<ReturnType(Args...)>::invoke(Args... args) const
+{
+    return m_invoke(m_func, std::forward<Args>(args)...);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ReturnType, typename... Args>
+RTTR_INLINE ReturnType typed_method_handle<ReturnType(Args...)>::operator()(Args... args) const
+{
+    return m_invoke(m_func, std::forward<Args>(args)...);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Signature>
+RTTR_INLINE typed_method_handle<Signature> method::bind_signature() const
+{
+    static_assert(std::is_function<Signature>::value,
+                  "The template argument of bind_signature() has to be a function signature, e.g. 'int(my_class&, int)'.");
+
+    typed_method_handle<Signature> result;
+    create_handle(type::get<Signature*>(), &result);
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+
+template<typename ReturnType, typename Arg_List>
+struct make_call_signature;
+
+template<typename ReturnType, typename... Args>
+struct make_call_signature<ReturnType, std::tuple<Args...>>
+{
+    using type = ReturnType(Args...);
+};
+
+template<typename ReturnType, typename Object, typename Arg_List>
+struct make_member_call_signature;
+
+template<typename ReturnType, typename Object, typename... Args>
+struct make_member_call_signature<ReturnType, Object, std::tuple<Args...>>
+{
+    using type = ReturnType(Object, Args...);
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F>
+struct is_const_member_func : std::false_type {};
+
+template<typename R, typename C, typename... Args>
+struct is_const_member_func<R (C::*)(Args...) const> : std::true_type {};
+
+template<typename R, typename C, typename... Args>
+struct is_const_member_func<R (C::*)(Args...) const volatile> : std::true_type {};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F, typename Signature>
+struct typed_function_invoker;
+
+template<typename F, typename R, typename... Args>
+struct typed_function_invoker<F, R(Args...)>
+{
+    static R invoke(const void* func, Args... args)
+    {
+        return (*static_cast<const F*>(func))(std::forward<Args>(args)...);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F, typename Signature>
+struct typed_member_func_invoker;
+
+template<typename F, typename R, typename C, typename... Args>
+struct typed_member_func_invoker<F, R(C&, Args...)>
+{
+    static R invoke(const void* func, C& object, Args... args)
+    {
+        return (object.*(*static_cast<const F*>(func)))(std::forward<Args>(args)...);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Signature, typename Invoker>
+RTTR_INLINE bool write_typed_method_handle(const void* func, void* handle)
+{
+    *static_cast<typed_method_handle<Signature>*>(handle) = typed_method_handle<Signature>(func, &Invoker::invoke);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Writes a \ref typed_method_handle for the free function or function object \p func into \p handle,
+ * when \p signature is the pointer type of the call signature `R(Args...)` of \p func.
+ */
+template<typename F, bool = std::is_member_function_pointer<F>::value>
+struct typed_method_handle_creator
+{
+    using signature = typename make_call_signature<typename function_traits<F>::return_type,
+                                                   typename function_traits<F>::arg_types>::type;
+
+    static RTTR_INLINE bool create(const F& func, const type& signature_type, void* handle)
+    {
+        if (signature_type != type::get<signature*>())
+            return false;
+
+        return write_typed_method_handle<signature, typed_function_invoker<F, signature>>(&func, handle);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Writes a \ref typed_method_handle for the member function \p func into \p handle,
+ * when \p signature is the pointer type of the call signature `R(C&, Args...)`, or for a const member function
+ * also `R(const C&, Args...)`.
+ */
+template<typename F>
+struct typed_method_handle_creator<F, true>
+{
+    using class_type = typename function_traits<F>::class_type;
+    using return_type = typename function_traits<F>::return_type;
+    using arg_types = typename function_traits<F>::arg_types;
+    using signature = typename make_member_call_signature<return_type, class_type&, arg_types>::type;
+    using const_signature = typename make_member_call_signature<return_type, const class_type&, arg_types>::type;
+
+    static RTTR_INLINE bool create(const F& func, const type& signature_type, void* handle)
+    {
+        if (signature_type == type::get<signature*>())
+            return write_typed_method_handle<signature, typed_member_func_invoker<F, signature>>(&func, handle);
+
+        return create_const(func, signature_type, handle, is_const_member_func<F>());
+    }
+
+    static RTTR_INLINE bool create_const(const F& func, const type& signature_type, void* handle, std::true_type)
+    {
+        if (signature_type != type::get<const_signature*>())
+            return false;
+
+        return write_typed_method_handle<const_signature, typed_member_func_invoker<F, const_signature>>(&func, handle);
+    }
+
+    static RTTR_INLINE bool create_const(const F& func, const type& signature_type, void* handle, std::false_type)
+    {
+        return false;
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_TYPED_METHOD_HANDLE_IMPL_H_
@@ -0,0 +1,276 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_TYPED_PROPERTY_ACCESSOR_IMPL_H_
+#define RTTR_TYPED_PROPERTY_ACCESSOR_IMPL_H_
+
+#include "rttr/detail/misc/function_traits.h"
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ClassType, typename ValueType>
+RTTR_INLINE typed_property_accessor<ClassType, ValueType>::typed_property_accessor() RTTR_NOEXCEPT
+:   m_member(nullptr),
+    m_getter(nullptr),
+    m_setter(nullptr),
+    m_get_func(nullptr),
+    m_set_func(nullptr),
+    m_is_readonly(true)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ClassType, typename ValueType>
+RTTR_INLINE typed_property_accessor<ClassType, ValueType>::typed_property_accessor(member_ptr member, bool is_readonly) RTTR_NOEXCEPT
+:   m_member(member),
+    m_getter(nullptr),
+    m_setter(nullptr),
+    m_get_func(nullptr),
+    m_set_func(nullptr),
+    m_is_readonly(is_readonly)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ClassType, typename ValueType>
+RTTR_INLINE typed_property_accessor<ClassType, ValueType>::typed_property_accessor(const void* getter, getter_func get_func,
+                                                                                   const void* setter, setter_func set_func) RTTR_NOEXCEPT
+:   m_member(nullptr),
+    m_getter(getter),
+    m_setter(setter),
+    m_get_func(get_func),
+    m_set_func(set_func),
+    m_is_readonly(set_func == nullptr)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ClassType, typename ValueType>
+RTTR_INLINE bool typed_property_accessor<ClassType, ValueType>::is_valid() const RTTR_NOEXCEPT
+{
+    return (m_member != nullptr || m_get_func != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ClassType, typename ValueType>
+RTTR_INLINE typed_property_accessor<ClassType, ValueType>::operator bool() const RTTR_NOEXCEPT
+{
+    return is_valid();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ClassType, typename ValueType>
+RTTR_INLINE bool typed_property_accessor<ClassType, ValueType>::is_readonly() const RTTR_NOEXCEPT
+{
+    return m_is_readonly;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ClassType, typename ValueType>
+RTTR_INLINE ValueType typed_property_accessor<ClassType, ValueType>::get(const ClassType& object) const
+{
+    if (m_member != nullptr)
+        return (object.*m_member);
+    else
+        return m_get_func(m_getter, object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ClassType, typename ValueType>
+RTTR_INLINE bool typed_property_accessor<ClassType, ValueType>::set(ClassType& object, const ValueType& value) const
+{
+    if (m_is_readonly)
+        return false;
+
+    if (m_member != nullptr)
+        (object.*m_member) = value;
+    else
+        m_set_func(m_setter, object, value);
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ClassType, typename ValueType>
+RTTR_INLINE typed_property_accessor<ClassType, ValueType> property::get_accessor() const
+{
+    typed_property_accessor<ClassType, ValueType> result;
+    create_accessor(type::get<ClassType>(), type::get<ValueType>(), &result);
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+
+template<typename ClassType, typename ValueType, typename Getter>
+ValueType invoke_typed_getter(const void* getter, const ClassType& object)
+{
+    return (const_cast<ClassType&>(object).*(*static_cast<const Getter*>(getter)))();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ClassType, typename ValueType, typename Setter>
+void invoke_typed_setter(const void* setter, ClassType& object, const ValueType& value)
+{
+    (object.*(*static_cast<const Setter*>(setter)))(value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ClassType, typename ValueType, bool = !std::is_array<ValueType>::value>
+struct typed_property_accessor_creator
+{
+    using accessor_type = typed_property_accessor<ClassType, ValueType>;
+
+    template<typename Member>
+    static bool from_member(Member ClassType::* acc, bool is_readonly, void* accessor)
+    {
+        *static_cast<accessor_type*>(accessor) = accessor_type(const_cast<ValueType ClassType::*>(acc), is_readonly);
+        return true;
+    }
+
+    template<typename Getter>
+    static bool from_getter(const Getter& getter, void* accessor)
+    {
+        *static_cast<accessor_type*>(accessor) = accessor_type(&getter, &invoke_typed_getter<ClassType, ValueType, Getter>,
+                                                              nullptr, nullptr);
+        return true;
+    }
+
+    template<typename Getter, typename Setter>
+    static bool from_getter_setter(const Getter& getter, const Setter& setter, void* accessor)
+    {
+        using arg_type = param_types_t<Setter, 0>;
+        // a setter, which takes its argument by non-const reference, cannot be called with a const value
+        using is_setter_callable = std::integral_constant<bool, !std::is_reference<arg_type>::value ||
+                                                                std::is_const<remove_reference_t<arg_type>>::value>;
+        return from_getter_setter(getter, setter, accessor, is_setter_callable());
+    }
+
+    template<typename Getter, typename Setter>
+    static bool from_getter_setter(const Getter& getter, const Setter& setter, void* accessor, std::true_type)
+    {
+        *static_cast<accessor_type*>(accessor) = accessor_type(&getter, &invoke_typed_getter<ClassType, ValueType, Getter>,
+                                                              &setter, &invoke_typed_setter<ClassType, ValueType, Setter>);
+        return true;
+    }
+
+    template<typename Getter, typename Setter>
+    static bool from_getter_setter(const Getter& getter, const Setter& setter, void* accessor, std::false_type)
+    {
+        return from_getter(getter, accessor);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename ClassType, typename ValueType>
+struct typed_property_accessor_creator<ClassType, ValueType, false>
+{
+    template<typename Member>
+    static bool from_member(Member ClassType::* acc, bool is_readonly, void* accessor) { return false; }
+
+    template<typename Getter>
+    static bool from_getter(const Getter& getter, void* accessor) { return false; }
+
+    template<typename Getter, typename Setter>
+    static bool from_getter_setter(const Getter& getter, const Setter& setter, void* accessor) { return false; }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Writes a \ref typed_property_accessor for the pointer to member \p acc into \p accessor,
+ *        when \p class_type and \p value_type match the class and type of the member.
+ */
+template<typename ClassType, typename A>
+RTTR_INLINE bool create_member_object_accessor(A ClassType::* acc, bool is_readonly,
+                                               const type& class_type, const type& value_type, void* accessor)
+{
+    using value_t = remove_cv_t<A>;
+    if (class_type != type::get<ClassType>() || value_type != type::get<value_t>())
+        return false;
+
+    return typed_property_accessor_creator<ClassType, value_t>::from_member(acc, is_readonly, accessor);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Writes a read only \ref typed_property_accessor, which calls the member function \p getter,
+ *        into \p accessor, when \p class_type and \p value_type match the class and return type of the getter.
+ */
+template<typename ClassType, typename Getter>
+RTTR_INLINE bool create_member_func_accessor(const Getter& getter,
+                                             const type& class_type, const type& value_type, void* accessor)
+{
+    using value_t = remove_cv_t<remove_reference_t<typename function_traits<Getter>::return_type>>;
+    if (class_type != type::get<ClassType>() || value_type != type::get<value_t>())
+        return false;
+
+    return typed_property_accessor_creator<ClassType, value_t>::from_getter(getter, accessor);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Writes a \ref typed_property_accessor, which calls the member functions \p getter and \p setter,
+ *        into \p accessor, when \p class_type and \p value_type match the class and return type of the getter.
+ */
+template<typename ClassType, typename Getter, typename Setter>
+RTTR_INLINE bool create_member_func_accessor(const Getter& getter, const Setter& setter,
+                                             const type& class_type, const type& value_type, void* accessor)
+{
+    using value_t = remove_cv_t<remove_reference_t<typename function_traits<Getter>::return_type>>;
+    if (class_type != type::get<ClassType>() || value_type != type::get<value_t>())
+        return false;
+
+    return typed_property_accessor_creator<ClassType, value_t>::from_getter_setter(getter, setter, accessor);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_TYPED_PROPERTY_ACCESSOR_IMPL_H_
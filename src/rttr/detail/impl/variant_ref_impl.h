@@ -0,0 +1,116 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_VARIANT_REF_IMPL_H_
+#define RTTR_VARIANT_REF_IMPL_H_
+
+#include "rttr/type.h"
+#include "rttr/variant.h"
+
+#include <memory>
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE variant_ref::variant_ref() RTTR_NOEXCEPT : m_ptr(nullptr), m_type_data(nullptr) {}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename Tp>
+RTTR_INLINE variant_ref::variant_ref(const T& value) RTTR_NOEXCEPT
+:   m_ptr(reinterpret_cast<const void*>(std::addressof(value))),
+    m_type_data(type::get<T>().m_type_data)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE variant_ref::variant_ref(const variant& var) RTTR_NOEXCEPT
+:   m_ptr(var.is_valid() ? var.get_ptr() : nullptr),
+    m_type_data(var.is_valid() ? var.get_type().m_type_data : nullptr)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool variant_ref::is_valid() const RTTR_NOEXCEPT
+{
+    return (m_ptr != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE variant_ref::operator bool() const RTTR_NOEXCEPT
+{
+    return (m_ptr != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE type variant_ref::get_type() const RTTR_NOEXCEPT
+{
+    return (m_type_data ? type(m_type_data) : detail::get_invalid_type());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool variant_ref::is_type() const RTTR_NOEXCEPT
+{
+    return (m_type_data == type::get<T>().m_type_data);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE const T& variant_ref::get_value() const RTTR_NOEXCEPT
+{
+    return *reinterpret_cast<const T*>(m_ptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE const void* variant_ref::get_ptr() const RTTR_NOEXCEPT
+{
+    return m_ptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool variant_ref::operator!=(const variant_ref& other) const
+{
+    return !(*this == other);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
+
+#endif // RTTR_VARIANT_REF_IMPL_H_
@@ -182,14 +182,14 @@ struct method_accessor
     /////////////////////////////////////////////////////////////////////////////////////
 
     template<std::size_t... Arg_Idx>
-    static RTTR_FORCE_INLINE variant invoke_variadic_impl(const F& func_ptr, const instance& obj, index_sequence<Arg_Idx...>, const std::vector<argument>& arg_list)
+    static RTTR_FORCE_INLINE variant invoke_variadic_impl(const F& func_ptr, const instance& obj, index_sequence<Arg_Idx...>, const argument_range& arg_list)
     {
         return invoker_class::invoke(func_ptr, obj, arg_list[Arg_Idx]...);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////
 
-    static RTTR_FORCE_INLINE variant invoke_variadic(const F& func_ptr, const instance& obj, const std::vector<argument>& arg_list)
+    static RTTR_FORCE_INLINE variant invoke_variadic(const F& func_ptr, const instance& obj, const argument_range& arg_list)
     {
         if (arg_list.size() == arg_count)
             return invoke_variadic_impl(func_ptr, obj, make_index_sequence<arg_count>(), arg_list);
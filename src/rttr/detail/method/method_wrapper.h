@@ -40,6 +40,7 @@
 #include "rttr/instance.h"
 #include "rttr/variant.h"
 #include "rttr/array_range.h"
+#include "rttr/typed_method_handle.h"
 
 #include <functional>
 #include <string>
@@ -114,11 +115,16 @@ class method_wrapper<F, Acc_Level, Policy, default_args<>, parameter_infos<Param
             return method_accessor<F, Policy>::invoke(m_func_acc, object, arg1, arg2, arg3, arg4, arg5, arg6);
         }
 
-        variant invoke_variadic(const instance& object, std::vector<argument>& args) const
+        variant invoke_variadic(const instance& object, const argument_range& args) const
         {
             return method_accessor<F, Policy>::invoke_variadic(m_func_acc, object, args);
         }
 
+        bool create_handle(const type& signature, void* handle) const
+        {
+            return typed_method_handle_creator<F>::create(m_func_acc, signature, handle);
+        }
+
     private:
         F  m_func_acc;
         parameter_infos<Param_Args...> m_param_infos;
@@ -192,7 +198,7 @@ class method_wrapper<F, Acc_Level, Policy, default_args<Default_Args...>, parame
             return invoke_with_defaults::invoke(m_func_acc, object, m_def_args.m_args, arg1, arg2, arg3, arg4, arg5, arg6);
         }
 
-        variant invoke_variadic(const instance& object, std::vector<argument>& args) const
+        variant invoke_variadic(const instance& object, const argument_range& args) const
         {
             if (args.size() <= function_traits<F>::arg_count)
                 return invoke_variadic_helper<invoke_with_defaults, arg_index_sequence>::invoke(args, m_func_acc, object, m_def_args.m_args);
@@ -200,6 +206,11 @@ class method_wrapper<F, Acc_Level, Policy, default_args<Default_Args...>, parame
                 return variant();
         }
 
+        bool create_handle(const type& signature, void* handle) const
+        {
+            return typed_method_handle_creator<F>::create(m_func_acc, signature, handle);
+        }
+
     private:
         F                               m_func_acc;
         default_args<Default_Args...>   m_def_args;
@@ -263,11 +274,16 @@ class method_wrapper<F, Acc_Level, Policy, default_args<>, parameter_infos<>, Me
             return method_accessor<F, Policy>::invoke(m_func_acc, object, arg1, arg2, arg3, arg4, arg5, arg6);
         }
 
-        variant invoke_variadic(const instance& object, std::vector<argument>& args) const
+        variant invoke_variadic(const instance& object, const argument_range& args) const
         {
             return method_accessor<F, Policy>::invoke_variadic(m_func_acc, object, args);
         }
 
+        bool create_handle(const type& signature, void* handle) const
+        {
+            return typed_method_handle_creator<F>::create(m_func_acc, signature, handle);
+        }
+
     private:
         F  m_func_acc;
 };
@@ -335,7 +351,7 @@ class method_wrapper<F, Acc_Level, Policy, default_args<Default_Args...>, parame
             return invoke_with_defaults::invoke(m_func_acc, object, m_def_args.m_args, arg1, arg2, arg3, arg4, arg5, arg6);
         }
 
-        variant invoke_variadic(const instance& object, std::vector<argument>& args) const
+        variant invoke_variadic(const instance& object, const argument_range& args) const
         {
             if (args.size() <= function_traits<F>::arg_count)
                 return invoke_variadic_helper<invoke_with_defaults, arg_index_sequence>::invoke(args, m_func_acc, object, m_def_args.m_args);
@@ -343,6 +359,11 @@ class method_wrapper<F, Acc_Level, Policy, default_args<Default_Args...>, parame
                 return variant();
         }
 
+        bool create_handle(const type& signature, void* handle) const
+        {
+            return typed_method_handle_creator<F>::create(m_func_acc, signature, handle);
+        }
+
     private:
         F                               m_func_acc;
         default_args<Default_Args...>   m_def_args;
@@ -223,13 +223,20 @@ variant method_wrapper_base::invoke(instance& object, argument& arg1, argument&
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-variant method_wrapper_base::invoke_variadic(const instance& object, std::vector<argument>& args) const
+variant method_wrapper_base::invoke_variadic(const instance& object, const argument_range& args) const
 {
     return variant();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool method_wrapper_base::create_handle(const type& signature, void* handle) const
+{
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 
 } // end namespace detail
 } // end namespace rttr
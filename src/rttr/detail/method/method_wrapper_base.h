@@ -33,6 +33,7 @@
 #include "rttr/type.h"
 #include "rttr/variant.h"
 #include "rttr/array_range.h"
+#include "rttr/argument_range.h"
 #include "rttr/parameter_info.h"
 #include "rttr/access_levels.h"
 #include "rttr/string_view.h"
@@ -85,7 +86,9 @@ class RTTR_API method_wrapper_base
         virtual variant invoke(instance& object, argument& arg1, argument& arg2, argument& arg3,
                                argument& arg4, argument& arg5, argument& arg6) const;
 
-        virtual variant invoke_variadic(const instance& object, std::vector<argument>& args) const;
+        virtual variant invoke_variadic(const instance& object, const argument_range& args) const;
+
+        virtual bool create_handle(const type& signature, void* handle) const;
     protected:
         void init() RTTR_NOEXCEPT;
     private:
@@ -33,6 +33,7 @@
 #include "rttr/detail/misc/std_type_traits.h"
 
 #include <vector>
+#include <unordered_map>
 #include <utility>
 #include <functional>
 #include <algorithm>
@@ -46,6 +47,10 @@ namespace detail
 /*!
  * \brief The flat_map class implements a simple map based on std::vector instead of a binary tree.
  *
+ * New items are appended at the end of the list and merged into the sorted part afterwards.
+ * Between \ref begin_bulk_insert() and \ref end_bulk_insert() this merge is deferred,
+ * so that many inserts are sorted at once, instead of shifting the whole list for every single insert.
+ * Until then, the unsorted items are found through a temporary hash index.
  */
 template<typename Key, typename Value, template<class> class Hash = std::hash, typename Compare = std::equal_to<Key>>
 class flat_map
@@ -83,7 +88,7 @@ class flat_map
         using hash_type = std::size_t;
 
 
-        flat_map() {}
+        flat_map() : m_sorted_count(0), m_is_bulk_insert(false) {}
 
     private:
         using has_type = Hash<Key>;
@@ -115,33 +120,37 @@ class flat_map
                 return;
 
             m_key_list.push_back(key_data_type{std::move(key), has_type()(key)});
-            std::stable_sort(m_key_list.begin(), m_key_list.end(), typename key_data_type::order());
+            m_value_list.push_back(std::move(value));
 
-            auto found_key = find_key_const(key);
-            if (found_key != m_key_list.cend())
-            {
-                const auto index = std::distance(m_key_list.cbegin(), found_key);
-                m_value_list.insert(m_value_list.begin() + index, std::move(value));
-            }
+            if (m_is_bulk_insert)
+                m_unsorted_index.emplace(m_key_list.back().m_hash_value, m_key_list.size() - 1);
+            else
+                merge_unsorted_items();
+        }
+
+        /*!
+         * \brief Defers the sorting of new inserted items, until \ref end_bulk_insert() is called.
+         */
+        void begin_bulk_insert()
+        {
+            m_is_bulk_insert = true;
+        }
+
+        /*!
+         * \brief Sorts all items, which were inserted since \ref begin_bulk_insert() was called.
+         */
+        void end_bulk_insert()
+        {
+            m_is_bulk_insert = false;
+            merge_unsorted_items();
         }
 
         template<typename T>
         const_iterator find(const T& key) const
         {
             const auto hash_value = Hash<T>()(key);
-            auto itr = std::lower_bound(m_key_list.begin(), m_key_list.end(),
-                                        hash_value,
-                                        typename key_data_type::order());
-            for (; itr != m_key_list.end(); ++itr)
-            {
-                auto& item = *itr;
-                if (item.m_hash_value != hash_value)
-                    break;
-
-                if (item.m_key == key)
-                    return (m_value_list.cbegin() + std::distance(m_key_list.cbegin(), itr));;
-            }
-            return m_value_list.cend();
+            const auto itr = find_key_impl(hash_value, [&key](const Key& item_key) { return (item_key == key); });
+            return (m_value_list.cbegin() + std::distance(m_key_list.cbegin(), itr));
         }
 
         iterator find(const Key& key)
@@ -173,12 +182,18 @@ class flat_map
 #if RTTR_NO_CXX11_CONST_EREASE_SUPPORT_IN_STL
         void erase(const Key& key)
         {
+            // the positions of the unsorted items would change
+            merge_unsorted_items();
+
             iterator_key itr = find_key(key);
             if (itr != m_key_list.end())
             {
                 auto value_itr = m_value_list.begin() + std::distance(m_key_list.begin(), itr);
                 if (value_itr != m_value_list.end())
                 {
+                    if (static_cast<std::size_t>(std::distance(m_key_list.begin(), itr)) < m_sorted_count)
+                        --m_sorted_count;
+
                     m_key_list.erase(itr);
                     m_value_list.erase(value_itr);
                 }
@@ -188,12 +203,18 @@ class flat_map
 #else
         void erase(const Key& key)
         {
+            // the positions of the unsorted items would change
+            merge_unsorted_items();
+
             const_iterator_key itr = find_key_const(key);
             if (itr != m_key_list.end())
             {
                 auto value_itr = m_value_list.cbegin() + std::distance(m_key_list.cbegin(), itr);
                 if (value_itr != m_value_list.cend())
                 {
+                    if (static_cast<std::size_t>(std::distance(m_key_list.cbegin(), itr)) < m_sorted_count)
+                        --m_sorted_count;
+
                     m_key_list.erase(itr);
                     m_value_list.erase(value_itr);
                 }
@@ -206,6 +227,8 @@ class flat_map
         {
             m_key_list.clear();
             m_value_list.clear();
+            m_unsorted_index.clear();
+            m_sorted_count = 0;
         }
 
         const std::vector<Value>& value_data() const
@@ -215,45 +238,120 @@ class flat_map
 
     private:
 
-        const_iterator_key find_key_const(const Key& key) const
+        template<typename Predicate>
+        const_iterator_key find_key_impl(hash_type hash_value, const Predicate& pred) const
         {
-            const auto hash_value = has_type()(key);
-            auto itr = std::lower_bound(m_key_list.begin(), m_key_list.end(),
+            const auto sorted_end = m_key_list.cbegin() + m_sorted_count;
+            auto itr = std::lower_bound(m_key_list.cbegin(), sorted_end,
                                         hash_value,
                                         typename key_data_type::order());
-            for (; itr != m_key_list.end(); ++itr)
+            for (; itr != sorted_end; ++itr)
             {
                 auto& item = *itr;
                 if (item.m_hash_value != hash_value)
                     break;
 
-                if (Compare()(item.m_key, key))
+                if (pred(item.m_key))
                     return itr;
             }
-            return m_key_list.end();
+
+            const auto unsorted_range = m_unsorted_index.equal_range(hash_value);
+            for (auto index_itr = unsorted_range.first; index_itr != unsorted_range.second; ++index_itr)
+            {
+                itr = m_key_list.cbegin() + index_itr->second;
+                if (pred(itr->m_key))
+                    return itr;
+            }
+
+            return m_key_list.cend();
+        }
+
+        const_iterator_key find_key_const(const Key& key) const
+        {
+            return find_key_impl(has_type()(key), [&key](const Key& item_key) { return Compare()(item_key, key); });
         }
 
         iterator_key find_key(const Key& key)
         {
-            const auto hash_value = has_type()(key);
-            auto itr = std::lower_bound(m_key_list.begin(), m_key_list.end(),
-                                        hash_value,
-                                        typename key_data_type::order());
-            for (; itr != m_key_list.end(); ++itr)
+            return (m_key_list.begin() + std::distance(m_key_list.cbegin(), find_key_const(key)));
+        }
+
+        std::size_t get_unsorted_count() const
+        {
+            return (m_key_list.size() - m_sorted_count);
+        }
+
+        /*!
+         * Sorts the unsorted items at the end of the list and merges them into the sorted part.
+         * Items with the same hash value keep their insertion order.
+         */
+        void merge_unsorted_items()
+        {
+            const auto unsorted_count = get_unsorted_count();
+            if (unsorted_count == 0)
+                return;
+
+            m_unsorted_index.clear();
+
+            if (unsorted_count == 1)
             {
-                auto& item = *itr;
-                if (item.m_hash_value != hash_value)
-                    break;
+                // a single new item is just rotated to its position
+                auto itr = std::upper_bound(m_key_list.begin(), m_key_list.begin() + m_sorted_count,
+                                            m_key_list.back().m_hash_value,
+                                            typename key_data_type::order());
+                const auto index = std::distance(m_key_list.begin(), itr);
+                std::rotate(itr, m_key_list.end() - 1, m_key_list.end());
+                std::rotate(m_value_list.begin() + index, m_value_list.end() - 1, m_value_list.end());
+                m_sorted_count = m_key_list.size();
+                return;
+            }
 
-                if (Compare()(item.m_key, key))
-                    return itr;
+            std::vector<std::size_t> unsorted_indices;
+            unsorted_indices.reserve(unsorted_count);
+            for (std::size_t i = m_sorted_count; i < m_key_list.size(); ++i)
+                unsorted_indices.push_back(i);
+
+            std::stable_sort(unsorted_indices.begin(), unsorted_indices.end(),
+                             [this](std::size_t left, std::size_t right)
+                             { return (m_key_list[left].m_hash_value < m_key_list[right].m_hash_value); });
+
+            std::vector<key_data_type> key_list;
+            std::vector<Value> value_list;
+            key_list.reserve(m_key_list.size());
+            value_list.reserve(m_value_list.size());
+
+            std::size_t sorted_index = 0;
+            auto unsorted_itr = unsorted_indices.cbegin();
+            while (sorted_index < m_sorted_count || unsorted_itr != unsorted_indices.cend())
+            {
+                std::size_t index;
+                if (unsorted_itr == unsorted_indices.cend() ||
+                    (sorted_index < m_sorted_count &&
+                     m_key_list[sorted_index].m_hash_value <= m_key_list[*unsorted_itr].m_hash_value))
+                {
+                    index = sorted_index++;
+                }
+                else
+                {
+                    index = *unsorted_itr++;
+                }
+
+                key_list.push_back(std::move(m_key_list[index]));
+                value_list.push_back(std::move(m_value_list[index]));
             }
-            return m_key_list.end();
+
+            m_key_list.swap(key_list);
+            m_value_list.swap(value_list);
+            m_sorted_count = m_key_list.size();
         }
 
     private:
         std::vector<key_data_type>  m_key_list;
         std::vector<Value>          m_value_list;
+        //! maps the hash value of every unsorted item to its position, only used during a bulk insert
+        std::unordered_multimap<hash_type, std::size_t> m_unsorted_index;
+        std::size_t                 m_sorted_count;
+        bool                        m_is_bulk_insert;
 };
 
 } // end namespace detail
@@ -110,24 +110,14 @@ class flat_multimap
 
         void insert(const Key&& key, Value&& value)
         {
-            m_key_list.push_back(key_data_type{std::move(key), has_type()(key)});
-            std::stable_sort(m_key_list.begin(), m_key_list.end(), typename key_data_type::order());
-
-            auto found_key = find_key_const(key);
-            if (found_key != m_key_list.cend())
-            {
-                auto itr_key = found_key;
-                for (; itr_key != m_key_list.cend(); ++itr_key)
-                {
-                    if (Compare()(itr_key->m_key, key))
-                        found_key = itr_key;
-                    else
-                        break;
-                }
-
-                const auto index = std::distance(m_key_list.cbegin(), found_key);
-                m_value_list.insert(m_value_list.begin() + index, std::move(value));
-            }
+            // insert behind all items with the same hash value, so the insertion order of equal keys is kept
+            const auto hash_value = has_type()(key);
+            auto itr = std::upper_bound(m_key_list.begin(), m_key_list.end(),
+                                        hash_value,
+                                        typename key_data_type::order());
+            const auto index = std::distance(m_key_list.begin(), itr);
+            m_key_list.insert(itr, key_data_type{std::move(key), hash_value});
+            m_value_list.insert(m_value_list.begin() + index, std::move(value));
         }
 
         iterator find(const Key& key)
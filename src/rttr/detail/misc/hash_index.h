@@ -0,0 +1,181 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_HASH_INDEX_H_
+#define RTTR_HASH_INDEX_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * \brief The \ref hash_index class implements a small open addressing hash table,
+ *        which maps precomputed hash values to positions inside a separate item list.
+ *
+ * The index does not own the items, therefore the same item list, which was used to build the index,
+ * has to be provided when searching. Several entries can share the same hash value;
+ * \ref find() will return the first matching item in the order the entries were given to \ref rebuild(),
+ * \ref find_unique() will return no item at all in that case.
+ */
+template<typename T>
+class hash_index
+{
+    struct slot
+    {
+        std::size_t m_hash_value;
+        std::size_t m_index;        // position in the item list + 1; zero marks an empty slot
+    };
+
+    public:
+        //! A pair of hash value and the position of the item in the item list.
+        using entry = std::pair<std::size_t, std::size_t>;
+
+        hash_index() : m_mask(0), m_count(0) {}
+
+        void rebuild(const std::vector<entry>& entries)
+        {
+            m_slots.clear();
+            m_count = 0;
+            if (entries.empty())
+                return;
+
+            // keep the load factor below 50%, so the probe sequences stay short
+            std::size_t capacity = 8;
+            while (capacity < entries.size() * 2)
+                capacity <<= 1;
+
+            m_slots.assign(capacity, slot{0, 0});
+            m_mask = capacity - 1;
+
+            // linear probing keeps the insertion order for entries with the same hash value
+            for (const auto& item : entries)
+                insert_slot(item);
+        }
+
+        /*!
+         * \brief Adds a single entry, without rebuilding the whole index.
+         *
+         * When the load factor would exceed 50%, the slots are doubled and all entries are inserted again,
+         * ordered by their position in the item list; i.e. the insertion is amortized constant.
+         */
+        void insert(const entry& item)
+        {
+            if (m_slots.empty() || (m_count + 1) * 2 > m_slots.size())
+            {
+                std::vector<entry> entries;
+                entries.reserve(m_count + 1);
+                for (const auto& item_slot : m_slots)
+                {
+                    if (item_slot.m_index != 0)
+                        entries.emplace_back(item_slot.m_hash_value, item_slot.m_index - 1);
+                }
+                std::sort(entries.begin(), entries.end(),
+                          [](const entry& left, const entry& right) { return (left.second < right.second); });
+                entries.push_back(item);
+                rebuild(entries);
+                return;
+            }
+
+            insert_slot(item);
+        }
+
+        template<typename Predicate>
+        const T* find(const std::vector<T>& items, std::size_t hash_value, const Predicate& pred) const
+        {
+            if (m_slots.empty())
+                return nullptr;
+
+            std::size_t pos = hash_value & m_mask;
+            while (m_slots[pos].m_index != 0)
+            {
+                const auto& item_slot = m_slots[pos];
+                if (item_slot.m_hash_value == hash_value && pred(items[item_slot.m_index - 1]))
+                    return &items[item_slot.m_index - 1];
+
+                pos = (pos + 1) & m_mask;
+            }
+
+            return nullptr;
+        }
+
+        /*!
+         * \brief Returns the item with the hash value \p hash_value, which satisfies the predicate \p pred,
+         *        only when it is the only such item; otherwise `nullptr`.
+         */
+        template<typename Predicate>
+        const T* find_unique(const std::vector<T>& items, std::size_t hash_value, const Predicate& pred) const
+        {
+            if (m_slots.empty())
+                return nullptr;
+
+            const T* result = nullptr;
+            std::size_t pos = hash_value & m_mask;
+            while (m_slots[pos].m_index != 0)
+            {
+                const auto& item_slot = m_slots[pos];
+                if (item_slot.m_hash_value == hash_value && pred(items[item_slot.m_index - 1]))
+                {
+                    if (result)
+                        return nullptr;
+
+                    result = &items[item_slot.m_index - 1];
+                }
+
+                pos = (pos + 1) & m_mask;
+            }
+
+            return result;
+        }
+
+    private:
+        void insert_slot(const entry& item)
+        {
+            std::size_t pos = item.first & m_mask;
+            while (m_slots[pos].m_index != 0)
+                pos = (pos + 1) & m_mask;
+
+            m_slots[pos] = slot{item.first, item.second + 1};
+            ++m_count;
+        }
+
+    private:
+        std::vector<slot>   m_slots;
+        std::size_t         m_mask;
+        std::size_t         m_count;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_HASH_INDEX_H_
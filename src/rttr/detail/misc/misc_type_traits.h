@@ -971,6 +971,15 @@ namespace detail
     template<typename T>
     struct is_copy_constructible<std::unique_ptr<T>> : std::false_type {};
 
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // workaround, because GCC prior version 5 does not provide 'std::is_trivially_copyable'
+    template<typename T>
+#if RTTR_COMPILER == RTTR_COMPILER_GNUC && RTTR_COMP_VER < 5000
+    struct is_trivially_copyable : std::integral_constant<bool, __has_trivial_copy(T)> {};
+#else
+    struct is_trivially_copyable : std::is_trivially_copyable<T> {};
+#endif
+
     /////////////////////////////////////////////////////////////////////////////////////////
 
     template<typename T>
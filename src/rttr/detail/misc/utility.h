@@ -498,6 +498,16 @@ RTTR_INLINE static std::size_t generate_hash(const char* text, std::size_t lengt
     return hash;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Combines the given hash value \p seed with the hash value \p value.
+ */
+RTTR_INLINE static std::size_t hash_combine(std::size_t seed, std::size_t value)
+{
+    return seed ^ (value + static_cast<std::size_t>(0x9e3779b9) + (seed << 6) + (seed >> 2));
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 // custom has functor, to make sure that "std::string" and "rttr::string_view" uses the same hashing algorithm
 template <typename T>
@@ -33,6 +33,7 @@
 #include "rttr/argument.h"
 #include "rttr/type.h"
 #include "rttr/array_range.h"
+#include "rttr/argument_range.h"
 
 #include <vector>
 
@@ -71,7 +72,7 @@ struct compare_with_type_list
 
 struct compare_with_arg_list
 {
-    static RTTR_INLINE bool compare(const array_range<parameter_info>& param_list, const std::vector<argument>& args)
+    static RTTR_INLINE bool compare(const array_range<parameter_info>& param_list, const argument_range& args)
     {
         const auto param_count = param_list.size();
         const auto arg_count = args.size();
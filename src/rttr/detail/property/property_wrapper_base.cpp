@@ -132,5 +132,26 @@ variant property_wrapper_base::get_value(instance& object) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant_ref property_wrapper_base::get_ref(instance& object) const
+{
+    return variant_ref();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool property_wrapper_base::create_accessor(const type& class_type, const type& value_type, void* accessor) const
+{
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool property_wrapper_base::get_offset(std::size_t& offset) const
+{
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace detail
 } // end namespace rttr
@@ -32,6 +32,7 @@
 #include "rttr/detail/metadata/metadata_handler.h"
 #include "rttr/type.h"
 #include "rttr/variant.h"
+#include "rttr/variant_ref.h"
 #include "rttr/access_levels.h"
 #include "rttr/string_view.h"
 
@@ -79,6 +80,12 @@ class RTTR_API property_wrapper_base
 
         virtual variant get_value(instance& object) const;
 
+        virtual variant_ref get_ref(instance& object) const;
+
+        virtual bool create_accessor(const type& class_type, const type& value_type, void* accessor) const;
+
+        virtual bool get_offset(std::size_t& offset) const;
+
     protected:
         void init() RTTR_NOEXCEPT;
 
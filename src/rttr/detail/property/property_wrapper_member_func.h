@@ -83,6 +83,11 @@ class property_wrapper<member_func_ptr, Getter, Setter, Acc_Level, return_as_cop
                 return variant();
         }
 
+        bool create_accessor(const type& class_type, const type& value_type, void* accessor) const
+        {
+            return create_member_func_accessor<typename function_traits<Getter>::class_type>(m_getter, m_setter, class_type, value_type, accessor);
+        }
+
     private:
         Getter  m_getter;
         Setter  m_setter;
@@ -133,6 +138,11 @@ class property_wrapper<member_func_ptr, Getter, void, Acc_Level, return_as_copy,
                 return variant();
         }
 
+        bool create_accessor(const type& class_type, const type& value_type, void* accessor) const
+        {
+            return create_member_func_accessor<typename function_traits<Getter>::class_type>(m_getter, class_type, value_type, accessor);
+        }
+
     private:
         Getter  m_getter;
 };
@@ -197,6 +207,11 @@ class property_wrapper<member_func_ptr, Getter, Setter, Acc_Level, return_as_ptr
                 return variant();
         }
 
+        bool create_accessor(const type& class_type, const type& value_type, void* accessor) const
+        {
+            return create_member_func_accessor<typename function_traits<Getter>::class_type>(m_getter, m_setter, class_type, value_type, accessor);
+        }
+
     private:
         Getter  m_getter;
         Setter  m_setter;
@@ -251,6 +266,11 @@ class property_wrapper<member_func_ptr, Getter, void, Acc_Level, return_as_ptr,
                 return variant();
         }
 
+        bool create_accessor(const type& class_type, const type& value_type, void* accessor) const
+        {
+            return create_member_func_accessor<typename function_traits<Getter>::class_type>(m_getter, class_type, value_type, accessor);
+        }
+
     private:
         Getter  m_getter;
 };
@@ -315,6 +335,11 @@ class property_wrapper<member_func_ptr, Getter, Setter, Acc_Level, get_as_ref_wr
                 return variant();
         }
 
+        bool create_accessor(const type& class_type, const type& value_type, void* accessor) const
+        {
+            return create_member_func_accessor<typename function_traits<Getter>::class_type>(m_getter, m_setter, class_type, value_type, accessor);
+        }
+
     private:
         Getter  m_getter;
         Setter  m_setter;
@@ -369,6 +394,11 @@ class property_wrapper<member_func_ptr, Getter, void, Acc_Level, get_as_ref_wrap
                 return variant();
         }
 
+        bool create_accessor(const type& class_type, const type& value_type, void* accessor) const
+        {
+            return create_member_func_accessor<typename function_traits<Getter>::class_type>(m_getter, class_type, value_type, accessor);
+        }
+
     private:
         Getter  m_getter;
 };
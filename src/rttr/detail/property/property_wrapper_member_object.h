@@ -28,6 +28,25 @@
 #ifndef RTTR_PROPERTY_WRAPPER_MEMBER_OBJECT_H_
 #define RTTR_PROPERTY_WRAPPER_MEMBER_OBJECT_H_
 
+/////////////////////////////////////////////////////////////////////////////////////////
+// Computes the offset in bytes of the member \p acc, relative to the begin of an object of the \p declaring_type.
+// The member is not accessed; only its address inside a suitably aligned storage is computed.
+// A member of a base class can be located anywhere inside the declaring type (e.g. in a non-primary base),
+// so an offset is only available, when \p C is the declaring type itself.
+
+template<typename C, typename A>
+RTTR_INLINE bool get_member_offset(A(C::* acc), const type& declaring_type, std::size_t& offset) RTTR_NOEXCEPT
+{
+    if (declaring_type != type::get<C>())
+        return false;
+
+    using storage_type = typename std::aligned_storage<sizeof(C), std::alignment_of<C>::value>::type;
+    storage_type storage;
+    const C* obj = reinterpret_cast<const C*>(&storage);
+    offset = static_cast<std::size_t>(reinterpret_cast<const char*>(&(obj->*acc)) - reinterpret_cast<const char*>(obj));
+    return true;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 // pointer to member - read write
@@ -73,6 +92,24 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, return_as_co
                 return variant();
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            if (C* ptr = object.try_convert<C>())
+                return variant_ref(ptr->*m_acc);
+            else
+                return variant_ref();
+        }
+
+        bool get_offset(std::size_t& offset) const
+        {
+            return get_member_offset(m_acc, get_declaring_type(), offset);
+        }
+
+        bool create_accessor(const type& class_type, const type& value_type, void* accessor) const
+        {
+            return create_member_object_accessor(m_acc, false, class_type, value_type, accessor);
+        }
+
     private:
         accessor m_acc;
 };
@@ -119,6 +156,24 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, return_as_co
                 return variant();
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            if (C* ptr = object.try_convert<C>())
+                return variant_ref(ptr->*m_acc);
+            else
+                return variant_ref();
+        }
+
+        bool get_offset(std::size_t& offset) const
+        {
+            return get_member_offset(m_acc, get_declaring_type(), offset);
+        }
+
+        bool create_accessor(const type& class_type, const type& value_type, void* accessor) const
+        {
+            return create_member_object_accessor(m_acc, true, class_type, value_type, accessor);
+        }
+
     private:
         accessor m_acc;
 };
@@ -175,6 +230,24 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, return_as_pt
                 return variant();
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            if (C* ptr = object.try_convert<C>())
+                return variant_ref(ptr->*m_acc);
+            else
+                return variant_ref();
+        }
+
+        bool get_offset(std::size_t& offset) const
+        {
+            return get_member_offset(m_acc, get_declaring_type(), offset);
+        }
+
+        bool create_accessor(const type& class_type, const type& value_type, void* accessor) const
+        {
+            return create_member_object_accessor(m_acc, false, class_type, value_type, accessor);
+        }
+
     private:
         accessor m_acc;
 };
@@ -221,6 +294,24 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, return_as_pt
                 return variant();
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            if (C* ptr = object.try_convert<C>())
+                return variant_ref(ptr->*m_acc);
+            else
+                return variant_ref();
+        }
+
+        bool get_offset(std::size_t& offset) const
+        {
+            return get_member_offset(m_acc, get_declaring_type(), offset);
+        }
+
+        bool create_accessor(const type& class_type, const type& value_type, void* accessor) const
+        {
+            return create_member_object_accessor(m_acc, true, class_type, value_type, accessor);
+        }
+
     private:
         accessor m_acc;
 };
@@ -276,6 +367,24 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, get_as_ref_w
                 return variant();
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            if (C* ptr = object.try_convert<C>())
+                return variant_ref(ptr->*m_acc);
+            else
+                return variant_ref();
+        }
+
+        bool get_offset(std::size_t& offset) const
+        {
+            return get_member_offset(m_acc, get_declaring_type(), offset);
+        }
+
+        bool create_accessor(const type& class_type, const type& value_type, void* accessor) const
+        {
+            return create_member_object_accessor(m_acc, false, class_type, value_type, accessor);
+        }
+
     private:
         accessor m_acc;
 };
@@ -322,6 +431,24 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, get_as_ref_w
                 return variant();
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            if (C* ptr = object.try_convert<C>())
+                return variant_ref(ptr->*m_acc);
+            else
+                return variant_ref();
+        }
+
+        bool get_offset(std::size_t& offset) const
+        {
+            return get_member_offset(m_acc, get_declaring_type(), offset);
+        }
+
+        bool create_accessor(const type& class_type, const type& value_type, void* accessor) const
+        {
+            return create_member_object_accessor(m_acc, true, class_type, value_type, accessor);
+        }
+
     private:
         accessor m_acc;
 };
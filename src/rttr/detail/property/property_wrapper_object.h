@@ -72,6 +72,11 @@ class property_wrapper<object_ptr, C*, void, Acc_Level, return_as_copy, set_valu
             return (variant(*m_accessor));
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            return variant_ref(*m_accessor);
+        }
+
     private:
         C* m_accessor;
 };
@@ -112,6 +117,11 @@ class property_wrapper<object_ptr, C*, void, Acc_Level, return_as_copy, read_onl
             return (variant(*m_accessor));
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            return variant_ref(*m_accessor);
+        }
+
     private:
         C* m_accessor;
 };
@@ -162,6 +172,11 @@ class property_wrapper<object_ptr, C*, void, Acc_Level, return_as_ptr, set_as_pt
             return (variant(m_accessor));
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            return variant_ref(*m_accessor);
+        }
+
     private:
         C* m_accessor;
 };
@@ -202,6 +217,11 @@ class property_wrapper<object_ptr, C*, void, Acc_Level, return_as_ptr, read_only
             return (variant(m_accessor));
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            return variant_ref(*m_accessor);
+        }
+
     private:
         C* m_accessor;
 };
@@ -251,6 +271,11 @@ class property_wrapper<object_ptr, C*, void, Acc_Level, get_as_ref_wrapper, set_
             return (variant(std::ref(*m_accessor)));
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            return variant_ref(*m_accessor);
+        }
+
     private:
         C* m_accessor;
 };
@@ -291,6 +316,11 @@ class property_wrapper<object_ptr, C*, void, Acc_Level, get_as_ref_wrapper, read
             return (variant(std::cref(*m_accessor)));
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            return variant_ref(*m_accessor);
+        }
+
     private:
         C* m_accessor;
 };
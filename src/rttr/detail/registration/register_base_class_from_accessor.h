@@ -51,8 +51,7 @@ template<typename ClassType, typename AccClassType>
 enable_if_t<!contains<AccClassType, typename ClassType::base_class_list>::value, void>
 register_member_accessor_class_type_when_needed_3()
 {
-    base_class_info baseClassInfo = { type::get<AccClassType>(), &rttr_cast_impl<ClassType, AccClassType> };
-    type_register::register_base_class(type::get<ClassType>(), baseClassInfo);
+    type_register::register_base_class(type::get<ClassType>(), create_base_class_info<ClassType, AccClassType>());
 }
 
 template<typename ClassType, typename AccClassType>
@@ -66,8 +65,7 @@ template<typename ClassType, typename AccClassType>
 enable_if_t<!has_base_class_list<ClassType>::value, void>
 register_member_accessor_class_type_when_needed_2()
 {
-    base_class_info baseClassInfo = { type::get<AccClassType>(), &rttr_cast_impl<ClassType, AccClassType> };
-    type_register::register_base_class(type::get<ClassType>(), baseClassInfo);
+    type_register::register_base_class(type::get<ClassType>(), create_base_class_info<ClassType, AccClassType>());
 }
 
 template<typename ClassType, typename AccClassType>
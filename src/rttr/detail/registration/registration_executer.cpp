@@ -26,6 +26,7 @@
 *************************************************************************************/
 
 #include "rttr/detail/registration/registration_executer.h"
+#include "rttr/detail/type/type_register.h"
 
 #include <algorithm>
 
@@ -44,6 +45,8 @@ registration_executer::registration_executer()
 
 registration_executer::~registration_executer()
 {
+    // the class items are flattened once, after all of them are registered
+    bulk_registration bulk_reg;
     for (auto&& item : m_list)
     {
         item.second();
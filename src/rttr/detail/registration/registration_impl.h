@@ -291,6 +291,7 @@ namespace                                                                \
     {                                                                    \
         rttr__auto__register__()                                         \
         {                                                                \
+            rttr::detail::bulk_registration bulk_reg;                    \
             rttr_auto_register_reflection_function_();                   \
         }                                                                \
     };                                                                   \
@@ -28,6 +28,10 @@
 #ifndef RTTR_BASE_CLASSES_H_
 #define RTTR_BASE_CLASSES_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
 
 namespace rttr
 {
@@ -36,11 +40,13 @@ namespace detail
 
 struct base_class_info
 {
-    base_class_info(type t, void*(*rttr_cast_func)(void*))
-    :   m_base_type(t), m_rttr_cast_func(rttr_cast_func)
+    base_class_info(type t, void*(*rttr_cast_func)(void*), bool is_constant_offset = false, std::ptrdiff_t offset = 0)
+    :   m_base_type(t), m_rttr_cast_func(rttr_cast_func), m_is_constant_offset(is_constant_offset), m_offset(offset)
     {}
     type            m_base_type;
     void*           (*m_rttr_cast_func)(void*);
+    bool            m_is_constant_offset;   //!< true, when the cast is a pointer adjustment by \ref m_offset bytes
+    std::ptrdiff_t  m_offset;
 };
 
 /*!
@@ -100,13 +106,65 @@ static void* rttr_cast_impl(void* ptr)
     return static_cast<void*>(static_cast<BaseType*>(static_cast<DerivedType*>(ptr)));
 }
 
+/*!
+ * This trait checks if \p BaseType is a virtual base class of \p DerivedType.
+ * A down cast from a virtual base class cannot be done with a static_cast.
+ */
+template<typename DerivedType, typename BaseType>
+class is_virtual_base_of_impl
+{
+    typedef char YesType[1];
+    typedef char NoType[2];
+
+    template<typename D, typename B, typename = decltype(static_cast<D*>(std::declval<B*>()))>
+    static NoType& test(int);
+
+    template<typename, typename>
+    static YesType& test(...);
+
+public:
+    static RTTR_CONSTEXPR_OR_CONST bool value = (sizeof(YesType) == sizeof(test<DerivedType, BaseType>(0)));
+};
+
+template<typename DerivedType, typename BaseType>
+using is_virtual_base_of = std::integral_constant<bool, is_virtual_base_of_impl<DerivedType, BaseType>::value>;
+
+/*!
+ * For a non virtual base class the pointer adjustment is the same for every instance,
+ * so it is calculated once with an arbitrary address, nothing is dereferenced here.
+ */
+template<typename DerivedType, typename BaseType>
+static base_class_info create_base_class_info(std::false_type)
+{
+    DerivedType* derived_ptr = reinterpret_cast<DerivedType*>(static_cast<std::uintptr_t>(0x10000));
+    BaseType* base_ptr = derived_ptr;
+    const std::ptrdiff_t offset = reinterpret_cast<char*>(base_ptr) - reinterpret_cast<char*>(derived_ptr);
+    return base_class_info(type::get<BaseType>(), &rttr_cast_impl<DerivedType, BaseType>, true, offset);
+}
+
+/*!
+ * The position of a virtual base class depends on the most derived class of the instance,
+ * so the cast function has to be used.
+ */
+template<typename DerivedType, typename BaseType>
+static base_class_info create_base_class_info(std::true_type)
+{
+    return base_class_info(type::get<BaseType>(), &rttr_cast_impl<DerivedType, BaseType>);
+}
+
+template<typename DerivedType, typename BaseType>
+static base_class_info create_base_class_info()
+{
+    return create_base_class_info<DerivedType, BaseType>(is_virtual_base_of<DerivedType, BaseType>());
+}
+
 template<typename DerivedClass, typename BaseClass, typename... U>
 struct type_from_base_classes<DerivedClass, BaseClass, U...>
 {
     static RTTR_INLINE void fill(info_container& vec)
     {
         static_assert(has_base_class_list<BaseClass>::value, "The parent class has no base class list defined - please use the macro RTTR_ENABLE");
-        vec.emplace_back(type::get<BaseClass>(), &rttr_cast_impl<DerivedClass, BaseClass>);
+        vec.push_back(create_base_class_info<DerivedClass, BaseClass>());
         // retrieve also the types of all base classes of the base classes; you will get an compile error here,
         // when the base class has not defined the 'base_class_list' typedef
         type_from_base_classes<DerivedClass, typename BaseClass::base_class_list>::fill(vec);
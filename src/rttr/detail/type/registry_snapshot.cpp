@@ -0,0 +1,243 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/type/registry_snapshot.h"
+
+#include "rttr/detail/type/type_register_p.h"
+#include "rttr/detail/type/type_data.h"
+#include "rttr/detail/filter/filter_item_funcs.h"
+#include "rttr/detail/parameter_info/parameter_infos_compare.h"
+#include "rttr/argument.h"
+
+using namespace std;
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static std::size_t get_name_buffer_size(const std::vector<type_data*>& type_data_list,
+                                        std::vector<T> class_data::* item_ptr)
+{
+    std::size_t size = 0;
+    for (const auto data : type_data_list)
+    {
+        if (data->raw_type_data != data)
+            continue;
+
+        for (const auto& item : data->get_class_data().*item_ptr)
+            size += item.get_name().length();
+    }
+
+    return size;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static void fill_member_table(sealed_member_table<T>& table,
+                              const std::vector<type_data*>& type_data_list,
+                              std::vector<T> class_data::* item_ptr,
+                              std::string& name_buffer)
+{
+    std::vector<hash_index<string_view>::entry> name_entries;
+    table.m_ranges.reserve(type_data_list.size());
+
+    for (const auto data : type_data_list)
+    {
+        const auto begin = table.m_items.size();
+        // only the raw types will be queried, the member lists of the other types are left empty
+        if (data->raw_type_data == data)
+        {
+            const auto type_id = data->type_index;
+            for (const auto& item : data->get_class_data().*item_ptr)
+            {
+                const auto name = item.get_name();
+                const auto name_pos = name_buffer.size();
+                name_buffer.append(name.data(), name.length());
+
+                name_entries.emplace_back(hash_combine(generate_hash(name.data(), name.length()), type_id),
+                                          table.m_items.size());
+                table.m_items.push_back(item);
+                table.m_names.emplace_back(name_buffer.data() + name_pos, name.length());
+                table.m_access_levels.push_back(item.get_access_level());
+            }
+        }
+
+        table.m_ranges.push_back({begin, table.m_items.size()});
+    }
+
+    table.m_name_index.rebuild(name_entries);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<registry_snapshot>& registry_snapshot::get_storage() RTTR_NOEXCEPT
+{
+    static std::unique_ptr<registry_snapshot> snapshot;
+    return snapshot;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<std::unique_ptr<registry_snapshot>>& get_discarded_snapshots()
+{
+    static std::vector<std::unique_ptr<registry_snapshot>> snapshots;
+    return snapshots;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void registry_snapshot::seal()
+{
+    type_register_private::update_dirty_classes();
+
+    const auto& type_data_list = type_register_private::get_type_data_storage();
+    std::unique_ptr<registry_snapshot> snapshot(new registry_snapshot);
+    snapshot->m_type_count = type_data_list.size();
+
+    // the buffer is allocated once, so the name views stay valid while the tables are filled
+    snapshot->m_name_buffer.reserve(get_name_buffer_size(type_data_list, &class_data::m_properties) +
+                                    get_name_buffer_size(type_data_list, &class_data::m_methods));
+
+    fill_member_table(snapshot->m_properties, type_data_list, &class_data::m_properties, snapshot->m_name_buffer);
+    fill_member_table(snapshot->m_methods, type_data_list, &class_data::m_methods, snapshot->m_name_buffer);
+
+    std::vector<hash_index<string_view>::entry> signature_entries;
+    std::vector<std::size_t> signature_hashes;
+    const auto& methods = snapshot->m_methods;
+    for (std::size_t type_id = 0; type_id < methods.m_ranges.size(); ++type_id)
+    {
+        const auto& range = methods.m_ranges[type_id];
+        for (auto index = range.m_begin; index < range.m_end; ++index)
+        {
+            signature_hashes.clear();
+            type_register_private::append_signature_hashes(methods.m_items[index], signature_hashes);
+            for (const auto hash_value : signature_hashes)
+                signature_entries.emplace_back(hash_combine(hash_value, type_id), index);
+        }
+    }
+    snapshot->m_method_signature_index.rebuild(signature_entries);
+
+    discard();
+    get_storage() = std::move(snapshot);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void registry_snapshot::discard()
+{
+    // the snapshot is kept alive, because the ranges returned by it might be still in use
+    if (get_storage())
+        get_discarded_snapshots().push_back(std::move(get_storage()));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+::rttr::property registry_snapshot::get_property(const type& raw_type, string_view name) const RTTR_NOEXCEPT
+{
+    auto prop = m_properties.find(raw_type, generate_hash(name.data(), name.length()), m_properties.m_name_index,
+                                  [this, name](std::size_t pos) { return (m_properties.m_names[pos] == name); });
+    if (prop)
+        return *prop;
+
+    return create_invalid_item<::rttr::property>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+array_range<::rttr::property> registry_snapshot::get_properties(const type& raw_type) const RTTR_NOEXCEPT
+{
+    return m_properties.get_public_items(raw_type);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+array_range<::rttr::property> registry_snapshot::get_properties(const type& raw_type, filter_items filter) const RTTR_NOEXCEPT
+{
+    return m_properties.get_items(raw_type, get_filter_predicate<::rttr::property>(raw_type, filter));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+::rttr::method registry_snapshot::get_method(const type& raw_type, string_view name) const RTTR_NOEXCEPT
+{
+    auto meth = m_methods.find(raw_type, generate_hash(name.data(), name.length()), m_methods.m_name_index,
+                               [this, name](std::size_t pos) { return (m_methods.m_names[pos] == name); });
+    if (meth)
+        return *meth;
+
+    return create_invalid_item<::rttr::method>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const ::rttr::method* registry_snapshot::find_method(const type& raw_type, string_view name,
+                                                     const std::vector<type>& type_list) const RTTR_NOEXCEPT
+{
+    return m_methods.find(raw_type, type_register_private::get_signature_hash(name, type_list), m_method_signature_index,
+                          [this, name, &type_list](std::size_t pos)
+                          {
+                              return (m_methods.m_names[pos] == name &&
+                                      compare_with_type_list::compare(m_methods.m_items[pos].get_parameter_infos(), type_list));
+                          });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const ::rttr::method* registry_snapshot::find_method(const type& raw_type, string_view name,
+                                                     const argument_range& args) const RTTR_NOEXCEPT
+{
+    return m_methods.find(raw_type, type_register_private::get_signature_hash(name, args), m_method_signature_index,
+                          [this, name, &args](std::size_t pos)
+                          {
+                              return (m_methods.m_names[pos] == name &&
+                                      compare_with_arg_list::compare(m_methods.m_items[pos].get_parameter_infos(), args));
+                          });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+array_range<::rttr::method> registry_snapshot::get_methods(const type& raw_type) const RTTR_NOEXCEPT
+{
+    return m_methods.get_public_items(raw_type);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+array_range<::rttr::method> registry_snapshot::get_methods(const type& raw_type, filter_items filter) const RTTR_NOEXCEPT
+{
+    return m_methods.get_items(raw_type, get_filter_predicate<::rttr::method>(raw_type, filter));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
@@ -0,0 +1,163 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_REGISTRY_SNAPSHOT_H_
+#define RTTR_REGISTRY_SNAPSHOT_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/hash_index.h"
+#include "rttr/detail/misc/utility.h"
+#include "rttr/access_levels.h"
+#include "rttr/array_range.h"
+#include "rttr/argument_range.h"
+#include "rttr/filter_item.h"
+#include "rttr/method.h"
+#include "rttr/property.h"
+#include "rttr/string_view.h"
+#include "rttr/type.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rttr
+{
+class argument;
+
+namespace detail
+{
+
+/*!
+ * \brief The \ref sealed_member_table stores the flattened members of all classes in one contiguous list.
+ *
+ * The members are kept as parallel arrays, so a name lookup only touches the hash slots and the name list,
+ * and the default iteration of the public members only the access level list.
+ */
+template<typename T>
+struct sealed_member_table
+{
+    struct member_range
+    {
+        std::size_t m_begin;
+        std::size_t m_end;
+    };
+
+    template<typename Predicate>
+    const T* find(const type& raw_type, std::size_t hash_value, const hash_index<string_view>& index,
+                  const Predicate& pred) const
+    {
+        const auto& range = m_ranges[raw_type.get_id()];
+        auto name = index.find(m_names, hash_combine(hash_value, raw_type.get_id()),
+                               [&](const string_view& item)
+                               {
+                                   const auto pos = static_cast<std::size_t>(&item - m_names.data());
+                                   return (pos >= range.m_begin && pos < range.m_end && pred(pos));
+                               });
+        return (name ? &m_items[name - m_names.data()] : nullptr);
+    }
+
+    array_range<T> get_items(const type& raw_type, default_predicate<T> pred) const
+    {
+        const auto& range = m_ranges[raw_type.get_id()];
+        if (range.m_begin == range.m_end)
+            return array_range<T>();
+
+        return array_range<T>(&m_items[range.m_begin], range.m_end - range.m_begin, std::move(pred));
+    }
+
+    array_range<T> get_public_items(const type& raw_type) const
+    {
+        const auto items = m_items.data();
+        const auto levels = m_access_levels.data();
+        return get_items(raw_type, default_predicate<T>([items, levels](const T& item)
+                                                        {
+                                                            return (levels[&item - items] == access_levels::public_access);
+                                                        }));
+    }
+
+    std::vector<member_range>   m_ranges;       // indexed by the id of the class type
+    std::vector<T>              m_items;
+    std::vector<string_view>    m_names;        // views into 'registry_snapshot::m_name_buffer'
+    std::vector<access_levels>  m_access_levels;
+    hash_index<string_view>     m_name_index;   // name hash combined with the id of the class type
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief The \ref registry_snapshot is a compact, read-only copy of the class members of all registered types.
+ *
+ * It is created with `registration::seal()` and will be discarded, as soon as another class member is registered.
+ * A discarded snapshot is not destroyed, because the ranges returned by it might be still in use.
+ * As long as it exists, the member queries of \ref type are answered from it,
+ * instead of from the per class data, which is spread over the whole heap.
+ */
+class RTTR_LOCAL registry_snapshot
+{
+    public:
+        static void seal();
+        static void discard();
+
+        /*!
+         * \brief Returns the sealed snapshot, when it contains the members of the class type \p raw_type;
+         *        otherwise a `nullptr`.
+         */
+        static RTTR_INLINE const registry_snapshot* get(const type& raw_type) RTTR_NOEXCEPT
+        {
+            const auto snapshot = get_storage().get();
+            return ((snapshot && raw_type.get_id() < snapshot->m_type_count) ? snapshot : nullptr);
+        }
+
+        ::rttr::property get_property(const type& raw_type, string_view name) const RTTR_NOEXCEPT;
+        array_range<::rttr::property> get_properties(const type& raw_type) const RTTR_NOEXCEPT;
+        array_range<::rttr::property> get_properties(const type& raw_type, filter_items filter) const RTTR_NOEXCEPT;
+
+        ::rttr::method get_method(const type& raw_type, string_view name) const RTTR_NOEXCEPT;
+        const ::rttr::method* find_method(const type& raw_type, string_view name,
+                                          const std::vector<type>& type_list) const RTTR_NOEXCEPT;
+        const ::rttr::method* find_method(const type& raw_type, string_view name,
+                                          const argument_range& args) const RTTR_NOEXCEPT;
+        array_range<::rttr::method> get_methods(const type& raw_type) const RTTR_NOEXCEPT;
+        array_range<::rttr::method> get_methods(const type& raw_type, filter_items filter) const RTTR_NOEXCEPT;
+
+    private:
+        registry_snapshot() : m_type_count(0) {}
+
+        static std::unique_ptr<registry_snapshot>& get_storage() RTTR_NOEXCEPT;
+
+    private:
+        std::size_t                             m_type_count;
+        std::string                             m_name_buffer;
+        sealed_member_table<::rttr::property>   m_properties;
+        sealed_member_table<::rttr::method>     m_methods;
+        hash_index<string_view>                 m_method_signature_index;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_REGISTRY_SNAPSHOT_H_
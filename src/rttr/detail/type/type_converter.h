@@ -32,6 +32,8 @@
 #include "rttr/array_mapper.h"
 #include "rttr/variant.h"
 
+#include <vector>
+
 namespace rttr
 {
 
@@ -42,11 +44,13 @@ namespace detail
 
 struct RTTR_LOCAL type_converter_base
 {
-    type_converter_base(const type& target_type) : m_target_type(target_type) {}
+    type_converter_base(const type& target_type, bool is_chain = false) : m_target_type(target_type), m_is_chain(is_chain) {}
     virtual variant to_variant(void* data, bool& ok) const = 0;
     virtual ~type_converter_base() {}
 
     type m_target_type;
+    //! When `true`, this is a \ref type_converter_chain and no \ref type_converter_target
+    bool m_is_chain;
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -79,6 +83,31 @@ struct type_converter : type_converter_target<TargetType>
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+/*!
+ * Converts a source type to a target type, for which no converter was registered directly,
+ * by invoking a path of registered converters one after another; e.g. `A -> B -> std::string`.
+ */
+struct RTTR_LOCAL type_converter_chain : type_converter_base
+{
+    type_converter_chain(std::vector<const type_converter_base*> path)
+    :   type_converter_base(path.back()->m_target_type, true), m_path(std::move(path))
+    {
+    }
+
+    variant to_variant(void* data, bool& ok) const
+    {
+        variant value = m_path.front()->to_variant(data, ok);
+        for (auto itr = m_path.cbegin() + 1; ok && itr != m_path.cend(); ++itr)
+            value = (*itr)->to_variant(value.get_ptr(), ok);
+
+        return value;
+    }
+
+    std::vector<const type_converter_base*> m_path;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace detail
 } // end namespace rttr
 
@@ -36,6 +36,8 @@
 #include "rttr/detail/type/type_register.h"
 #include "rttr/detail/type/type_name.h"
 #include "rttr/detail/misc/utility.h"
+#include "rttr/detail/misc/hash_index.h"
+#include "rttr/detail/conversion/builtin_conversion.h"
 #include "rttr/destructor.h"
 #include "rttr/method.h"
 #include "rttr/property.h"
@@ -43,7 +45,9 @@
 #include "rttr/destructor.h"
 
 #include <type_traits>
+#include <atomic>
 #include <bitset>
+#include <limits>
 
 
 namespace rttr
@@ -63,18 +67,46 @@ using get_derived_info_func = derived_info(*)(void*);
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+/*!
+ * Describes how a pointer to a class is converted to a pointer of one of its base classes;
+ * either by a constant pointer adjustment or by calling a cast function.
+ */
+struct base_class_cast
+{
+    rttr_cast_func  m_cast_func;    //!< nullptr, when the conversion is a constant pointer adjustment
+    std::ptrdiff_t  m_offset;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 struct class_data
 {
     class_data(get_derived_info_func func) : m_derived_info_func(func),
+                                             m_base_type_index(m_invalid_base_type_index),
+                                             m_members_dirty(false),
                                              m_dtor(create_invalid_item<destructor>())
     {}
 
+    static const std::size_t    m_invalid_base_type_index = static_cast<std::size_t>(-1);
+
     get_derived_info_func       m_derived_info_func;
     std::vector<type>           m_base_types;
     std::vector<type>           m_derived_types;
-    std::vector<rttr_cast_func> m_conversion_list;
+    std::vector<base_class_cast> m_conversion_list;
+    //! maps the id of a base type to its position in 'm_base_types' and 'm_conversion_list'
+    hash_index<type>            m_conversion_index;
+    //! dense index of this type, assigned when it is used the first time as base class
+    std::size_t                 m_base_type_index;
+    //! contains a set bit at the 'm_base_type_index' of every base class of this type
+    std::vector<bool>           m_base_type_set;
     std::vector<property>       m_properties;
     std::vector<method>         m_methods;
+    hash_index<property>        m_property_index;
+    hash_index<method>          m_method_index;
+    hash_index<method>          m_method_signature_index;
+    //! true, when 'm_properties' or 'm_methods' do not contain all base class items or are not indexed yet;
+    //! it is cleared with release semantic, after the items were flattened
+    std::atomic<bool>           m_members_dirty;
     std::vector<constructor>    m_ctors;
     destructor                  m_dtor;
 };
@@ -90,6 +122,7 @@ enum class type_trait_infos : std::size_t
     is_member_object_pointer,
     is_member_function_pointer,
     is_associative_container,
+    is_trivially_copyable,
 
     TYPE_TRAIT_COUNT
 };
@@ -126,17 +159,34 @@ struct type_data
 
     class_data& (*get_class_data)();
 
-    uint16_t type_index;
-    static const uint16_t m_invalid_id = 0;
+    type::type_id type_index;
+    static const type::type_id m_invalid_id = 0;
     RTTR_FORCE_INLINE bool is_valid() const RTTR_NOEXCEPT { return (type_index != m_invalid_id); }
     RTTR_FORCE_INLINE bool type_trait_value(type_trait_infos type_trait) const RTTR_NOEXCEPT { return m_type_traits.test(static_cast<std::size_t>(type_trait)); }
 
 
     type_traits m_type_traits;
+    builtin_type m_builtin_type;
+    //! the built-in type of the underlying type, when this type is an enumeration
+    builtin_type m_underlying_builtin_type;
+    //! the built-in type with the same value representation, see 'value_builtin_type_of'
+    builtin_type m_value_builtin_type;
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+/*!
+ * Returns the id of the next registered type, after \p last_id was assigned;
+ * or \ref type_data::m_invalid_id, when all ids are in use.
+ */
+static RTTR_INLINE type::type_id get_next_type_id(type::type_id last_id) RTTR_NOEXCEPT
+{
+    return (last_id == std::numeric_limits<type::type_id>::max() ? type_data::m_invalid_id
+                                                                 : static_cast<type::type_id>(last_id + 1));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 template<typename T>
 static class_data& get_type_class_data() RTTR_NOEXCEPT
 {
@@ -255,7 +305,11 @@ type_data& get_type_data() RTTR_NOEXCEPT
                                                         TYPE_TRAIT_TO_BITSET_VALUE_2(is_function_ptr, is_function_pointer) |
                                                         TYPE_TRAIT_TO_BITSET_VALUE(is_member_object_pointer) |
                                                         TYPE_TRAIT_TO_BITSET_VALUE(is_member_function_pointer) |
-                                                        TYPE_TRAIT_TO_BITSET_VALUE_2(::rttr::detail::is_associative_container, is_associative_container)}
+                                                        TYPE_TRAIT_TO_BITSET_VALUE_2(::rttr::detail::is_associative_container, is_associative_container) |
+                                                        TYPE_TRAIT_TO_BITSET_VALUE_2(::rttr::detail::is_trivially_copyable, is_trivially_copyable)},
+                                      builtin_type_of<T>::value,
+                                      underlying_builtin_type_of<T>::value,
+                                      value_builtin_type_of<T>::value
                                       };
     return instance;
 }
@@ -272,7 +326,10 @@ static type_data& get_invalid_type_data_impl() RTTR_NOEXCEPT
                                       &base_classes<void>::get_types,
                                       &get_invalid_type_class_data,
                                       0,
-                                      type_trait_value{0}};
+                                      type_trait_value{0},
+                                      builtin_type::none,
+                                      builtin_type::none,
+                                      builtin_type::none};
 
     instance.raw_type_data  = &instance;
     instance.wrapped_type   = &instance;
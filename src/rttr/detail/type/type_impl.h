@@ -38,6 +38,7 @@
 #include "rttr/detail/misc/utility.h"
 #include "rttr/wrapper_mapper.h"
 #include "rttr/detail/type/type_comparator.h"
+#include "rttr/detail/type/type_hasher.h"
 #include "rttr/detail/type/type_data.h"
 #include "rttr/detail/type/type_name.h"
 
@@ -250,6 +251,13 @@ RTTR_FORCE_INLINE bool type::is_member_function_pointer() const RTTR_NOEXCEPT
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+RTTR_FORCE_INLINE bool type::is_trivially_copyable() const RTTR_NOEXCEPT
+{
+    return m_type_data->type_trait_value(detail::type_trait_infos::is_trivially_copyable);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 RTTR_FORCE_INLINE bool type::is_wrapper() const RTTR_NOEXCEPT
 {
     return m_type_data->wrapped_type->is_valid();
@@ -460,6 +468,15 @@ void type::register_less_than_comparator()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename T>
+void type::register_hasher()
+{
+    static detail::type_hasher<T> hasher;
+    detail::type_register::hasher(type::get<T>(), &hasher);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace rttr
 
 
@@ -28,6 +28,7 @@
 #include "rttr/detail/type/type_register.h"
 
 #include "rttr/detail/type/type_register_p.h"
+#include "rttr/detail/type/registry_snapshot.h"
 
 #include "rttr/detail/constructor/constructor_wrapper_base.h"
 #include "rttr/detail/destructor/destructor_wrapper_base.h"
@@ -41,11 +42,15 @@
 #include "rttr/property.h"
 #include "rttr/method.h"
 #include "rttr/detail/type/type_data.h"
+#include "rttr/detail/type/type_converter.h"
 
 #include "rttr/detail/filter/filter_item_funcs.h"
 #include "rttr/detail/type/type_string_utils.h"
 
 #include <set>
+#include <mutex>
+#include <unordered_map>
+#include <algorithm>
 
 using namespace std;
 
@@ -137,6 +142,23 @@ void type_register::less_than_comparator(const type& t, type_comparator_base* co
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+void type_register::hasher(const type& t, type_hasher_base* hasher)
+{
+    type_register_private::hasher(t, hasher);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static base_class_cast get_base_class_cast(const base_class_info& base_info)
+{
+    if (base_info.m_is_constant_offset)
+        return base_class_cast{nullptr, base_info.m_offset};
+    else
+        return base_class_cast{base_info.m_rttr_cast_func, 0};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void type_register::register_base_class(const type& derived_type, const base_class_info& base_info)
 {
     auto& class_data = derived_type.m_type_data->get_class_data();
@@ -149,7 +171,7 @@ void type_register::register_base_class(const type& derived_type, const base_cla
     if (itr != class_data.m_base_types.end()) // already registerd as base class => quit
         return;
 
-    std::vector<std::pair<type, rttr_cast_func>> tmp_sort_vec;
+    std::vector<std::pair<type, base_class_cast>> tmp_sort_vec;
     using sorted_pair = decltype(tmp_sort_vec)::value_type;
     if (class_data.m_base_types.size() != class_data.m_conversion_list.size())
         return; // error!!!
@@ -161,7 +183,7 @@ void type_register::register_base_class(const type& derived_type, const base_cla
         ++index;
     }
 
-    tmp_sort_vec.emplace_back(base_info.m_base_type, base_info.m_rttr_cast_func);
+    tmp_sort_vec.emplace_back(base_info.m_base_type, get_base_class_cast(base_info));
     std::sort(tmp_sort_vec.begin(), tmp_sort_vec.end(),
     [](const sorted_pair& left, const sorted_pair& right)
     { return left.first.get_id() < right.first.get_id(); });
@@ -177,10 +199,29 @@ void type_register::register_base_class(const type& derived_type, const base_cla
     std::transform(tmp_sort_vec.begin(),
                    tmp_sort_vec.end(),
                    std::back_inserter(class_data.m_conversion_list),
-                   [](const sorted_pair& item)-> rttr_cast_func { return item.second; });
+                   [](const sorted_pair& item)-> base_class_cast { return item.second; });
 
     auto r_type = base_info.m_base_type.get_raw_type();
     r_type.m_type_data->get_class_data().m_derived_types.push_back(type(derived_type.m_type_data));
+    type_register_private::register_base_type_set(class_data, base_info.m_base_type);
+    type_register_private::update_conversion_index(class_data);
+
+    if (r_type.m_type_data->get_class_data().m_members_dirty)
+        type_register_private::mark_class_members_dirty(derived_type);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register::begin_bulk_registration()
+{
+    type_register_private::begin_bulk_registration();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register::end_bulk_registration()
+{
+    type_register_private::end_bulk_registration();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -230,55 +271,196 @@ flat_map<std::string, type, hash>& type_register_private::get_custom_name_to_id(
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::vector<type_register_private::data_container<type_converter_base>>& type_register_private::get_type_converter_list()
+/*!
+ * Maps the hash values of the type names to the positions in the type storage,
+ * i.e. to the type ids. It is updated for every new registered type;
+ * when custom names are registered, it is rebuilt once, at the end of the registration.
+ * The lookups never modify the index, so they can be done concurrently.
+ */
+struct type_name_index
 {
-    static std::vector<data_container<type_converter_base>> obj;
+    type_name_index() : m_is_dirty(false) {}
+
+    hash_index<type>    m_index;
+    bool                m_is_dirty;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static type_name_index& get_type_name_index()
+{
+    static type_name_index obj;
     return obj;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::vector<type_register_private::data_container<const type_comparator_base*>>& type_register_private::get_type_comparator_list()
+static void update_type_name_index()
 {
-    static std::vector<data_container<const type_comparator_base*>> obj;
-    return obj;
+    auto& name_index = get_type_name_index();
+    if (!name_index.m_is_dirty)
+        return;
+
+    const auto& type_list = type_register_private::get_type_storage();
+    std::vector<hash_index<type>::entry> entries;
+    entries.reserve(type_list.size());
+    // the invalid type at index zero is never found by name
+    for (std::size_t i = 1; i < type_list.size(); ++i)
+    {
+        const auto name = type_list[i].get_name();
+        entries.emplace_back(generate_hash(name.data(), name.length()), i);
+    }
+
+    name_index.m_index.rebuild(entries);
+    name_index.m_is_dirty = false;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::vector<type_register_private::data_container<const type_comparator_base*>>& type_register_private::get_type_equal_comparator_list()
+type type_register_private::get_type_by_name(string_view name)
 {
-    static std::vector<data_container<const type_comparator_base*>> obj;
-    return obj;
+    const auto& type_list = get_type_storage();
+    const auto& name_index = get_type_name_index();
+    const auto pred = [name](const type& item) { return (item.get_name() == name); };
+    // custom names were registered, but the registration has not finished yet
+    if (name_index.m_is_dirty)
+    {
+        auto itr = std::find_if(type_list.begin() + 1, type_list.end(), pred);
+        return (itr != type_list.end() ? *itr : get_invalid_type());
+    }
+
+    auto t = name_index.m_index.find(type_list, generate_hash(name.data(), name.length()), pred);
+    if (t)
+        return *t;
+
+    return get_invalid_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type type_register_private::get_type_by_name_hash(std::size_t hash_value)
+{
+    const auto& type_list = get_type_storage();
+    const auto& name_index = get_type_name_index();
+    // the hash value of the current name has to match, the index may still contain the hash of a replaced name
+    const auto pred = [hash_value](const type& item)
+    {
+        const auto name = item.get_name();
+        return (generate_hash(name.data(), name.length()) == hash_value);
+    };
+
+    const type* t = nullptr;
+    if (name_index.m_is_dirty)
+    {
+        for (auto itr = type_list.begin() + 1; itr != type_list.end(); ++itr)
+        {
+            if (!pred(*itr))
+                continue;
+
+            if (t)
+                return get_invalid_type();
+
+            t = &*itr;
+        }
+    }
+    else
+    {
+        t = name_index.m_index.find_unique(type_list, hash_value, pred);
+    }
+
+    if (t)
+        return *t;
+
+    return get_invalid_type();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::vector<type_register_private::data_container<const type_comparator_base*>>& type_register_private::get_type_less_comparator_list()
+type_register_private::type_id_table<enumeration_wrapper_base>& type_register_private::get_enumeration_list()
 {
-    static std::vector<data_container<const type_comparator_base*>> obj;
+    static type_id_table<enumeration_wrapper_base> obj;
     return obj;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::vector<type_register_private::data_container<enumeration_wrapper_base>>& type_register_private::get_enumeration_list()
+type_register_private::type_id_table<std::vector<metadata>>& type_register_private::get_metadata_type_list()
 {
-    static std::vector<data_container<enumeration_wrapper_base>> obj;
+    static type_id_table<std::vector<metadata>> obj;
     return obj;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::vector<type_register_private::data_container<std::vector<metadata>>>& type_register_private::get_metadata_type_list()
+type_register_private::type_id_table<type_register_private::conversion_data>& type_register_private::get_conversion_data_list()
 {
-    static std::vector<data_container<std::vector<metadata>>> obj;
+    static type_id_table<conversion_data> obj;
     return obj;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-bool type_register_private::register_name(uint16_t& id, type_data& info)
+static std::size_t& get_bulk_registration_depth()
+{
+    static std::size_t depth = 0;
+    return depth;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The types, which got a custom name during the current bulk registration;
+ * the names of their derived types and the name container are updated once, at its end.
+ */
+static std::vector<type>& get_renamed_type_list()
+{
+    static std::vector<type> type_list;
+    return type_list;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Serializes the flattening of the class items, which can be triggered by concurrent member queries,
+ * with the queries, which read the not yet flattened items.
+ */
+static std::mutex& get_class_members_mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::begin_bulk_registration()
+{
+    if (get_bulk_registration_depth()++ == 0)
+    {
+        get_orig_name_to_id().begin_bulk_insert();
+        get_custom_name_to_id().begin_bulk_insert();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::end_bulk_registration()
+{
+    if (get_bulk_registration_depth() == 0)
+        return;
+
+    if (--get_bulk_registration_depth() == 0)
+    {
+        get_orig_name_to_id().end_bulk_insert();
+        update_custom_names();
+        get_custom_name_to_id().end_bulk_insert();
+        update_type_name_index();
+        update_dirty_classes();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool type_register_private::register_name(type::type_id& id, type_data& info)
 {
     using namespace detail;
 
@@ -291,7 +473,14 @@ bool type_register_private::register_name(uint16_t& id, type_data& info)
     }
 
     static type::type_id m_type_id_counter = 0;
-    ++m_type_id_counter;
+    const type::type_id next_id = get_next_type_id(m_type_id_counter);
+    // all ids are used; the type cannot be registered and will be handled as invalid type
+    if (next_id == type_data::m_invalid_id)
+    {
+        id = type_data::m_invalid_id;
+        return true;
+    }
+    m_type_id_counter = next_id;
 
     orig_name_to_id.insert(std::make_pair(info.type_name, type(&info)));
     info.name = derive_name(*info.wrapped_type, *info.array_raw_type, info.type_name);
@@ -300,6 +489,8 @@ bool type_register_private::register_name(uint16_t& id, type_data& info)
     id = m_type_id_counter;
     info.type_index = id;
     get_type_storage().emplace_back(type(&info));
+    get_type_name_index().m_index.insert(std::make_pair(generate_hash(info.name.data(), info.name.length()),
+                                                        static_cast<std::size_t>(id)));
 
     return false;
 }
@@ -334,15 +525,59 @@ void type_register_private::register_base_class_info(type_data& info)
     for (const auto& t : base_classes)
     {
         class_data.m_base_types.push_back(t.m_base_type);
-        class_data.m_conversion_list.push_back(t.m_rttr_cast_func);
+        class_data.m_conversion_list.push_back(get_base_class_cast(t));
 
         auto r_type = t.m_base_type.get_raw_type();
         r_type.m_type_data->get_class_data().m_derived_types.push_back(type(&info));
+        register_base_type_set(class_data, t.m_base_type);
+    }
+
+    update_conversion_index(class_data);
+
+    // the items of the base classes will be inherited, when they are flattened
+    for (const auto& base_type : class_data.m_base_types)
+    {
+        if (base_type.m_type_data->get_class_data().m_members_dirty)
+        {
+            mark_class_members_dirty(type(&info));
+            break;
+        }
     }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+void type_register_private::register_base_type_set(class_data& derived_data, const type& base_type)
+{
+    static std::size_t base_type_count = 0;
+
+    auto& base_data = base_type.get_raw_type().m_type_data->get_class_data();
+    if (base_data.m_base_type_index == class_data::m_invalid_base_type_index)
+        base_data.m_base_type_index = base_type_count++;
+
+    const auto index = base_data.m_base_type_index;
+    if (index >= derived_data.m_base_type_set.size())
+        derived_data.m_base_type_set.resize(index + 1, false);
+
+    derived_data.m_base_type_set[index] = true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::update_conversion_index(class_data& data)
+{
+    std::vector<hash_index<type>::entry> entries;
+    entries.reserve(data.m_base_types.size());
+
+    std::size_t index = 0;
+    for (const auto& t : data.m_base_types)
+        entries.emplace_back(static_cast<std::size_t>(t.get_id()), index++);
+
+    data.m_conversion_index.rebuild(entries);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 type type_register_private::register_type(type_data& info) RTTR_NOEXCEPT
 {
     auto& type_data_container = get_type_data_storage();
@@ -350,7 +585,7 @@ type type_register_private::register_type(type_data& info) RTTR_NOEXCEPT
     info.get_base_types();
 
     using namespace detail;
-    uint16_t id = 0;
+    type::type_id id = 0;
     const bool isAlreadyRegistered = register_name(id, info);
     if (isAlreadyRegistered)
         return type(type_data_container[id]);
@@ -472,30 +707,45 @@ void type_register_private::register_custom_name(type& t, string_view custom_nam
     if (!t.is_valid())
         return;
 
-    auto& type_data = *t.m_type_data;
+    // a single custom name is handled like a bulk registration with one item
+    begin_bulk_registration();
 
-    const auto& orig_name = type_data.name;
-    auto& custom_name_to_id = get_custom_name_to_id();
-    custom_name_to_id.erase(orig_name);
+    t.m_type_data->name = custom_name.to_string();
+    get_renamed_type_list().push_back(t);
+    get_type_name_index().m_is_dirty = true;
 
-    type_data.name = custom_name.to_string();
+    end_bulk_registration();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::update_custom_names()
+{
+    auto& renamed_type_list = get_renamed_type_list();
+    if (renamed_type_list.empty())
+        return;
 
-    custom_name_to_id.insert(std::make_pair(type_data.name, t));
-    std::string raw_name = normalize_orig_name(t.m_type_data->type_name);
-    const auto& t_name = type_data.name;
+    const auto& type_list = get_type_storage();
+    std::vector<bool> is_renamed(type_list.size(), false);
+    for (const auto& t : renamed_type_list)
+        is_renamed[t.get_id()] = true;
 
-    auto tmp_type_list = custom_name_to_id.value_data();
-    for (auto& tt : tmp_type_list)
+    // the name container is filled again, instead of erasing every old name, which would be O(n^2)
+    auto& custom_name_to_id = get_custom_name_to_id();
+    custom_name_to_id.clear();
+    // the invalid type at index zero has no name
+    for (std::size_t i = 1; i < type_list.size(); ++i)
     {
-        if (tt.get_raw_array_type() == t && tt != t)
-        {
-            const auto& orig_name_derived = tt.m_type_data->name;
-            custom_name_to_id.erase(orig_name_derived);
+        const auto& t = type_list[i];
+        auto& data = *t.m_type_data;
+        // e.g. "const std::basic_string<char>*" => "const std::string*"
+        if (!is_renamed[i] && data.array_raw_type->is_valid() && is_renamed[data.array_raw_type->type_index])
+            data.name = derive_name(*data.wrapped_type, *data.array_raw_type, data.type_name);
 
-            tt.m_type_data->name = derive_name_impl(orig_name_derived, raw_name, t_name);
-            custom_name_to_id.insert(std::make_pair(tt.m_type_data->name, tt));
-        }
+        custom_name_to_id.insert(std::make_pair(data.name, t));
     }
+
+    renamed_type_list.clear();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -564,7 +814,12 @@ void type_register_private::property(const type& t, std::unique_ptr<property_wra
 
         property_list.emplace_back(detail::create_item<::rttr::property>(prop.get()));
         get_property_storage().push_back(std::move(prop));
-        update_class_list(t, &detail::class_data::m_properties);
+        mark_class_members_dirty(t);
+        registry_snapshot::discard();
+
+        // inside a bulk registration, the items are flattened once at its end
+        if (get_bulk_registration_depth() == 0)
+            update_dirty_classes();
     }
     else
     {
@@ -611,7 +866,12 @@ void type_register_private::method(const type& t, std::unique_ptr<method_wrapper
         auto& method_list = t.m_type_data->get_class_data().m_methods;
         method_list.emplace_back(create_item<::rttr::method>(meth.get()));
         get_method_storage().push_back(std::move(meth));
-        update_class_list(t, &class_data::m_methods);
+        mark_class_members_dirty(t);
+        registry_snapshot::discard();
+
+        // inside a bulk registration, the items are flattened once at its end
+        if (get_bulk_registration_depth() == 0)
+            update_dirty_classes();
     }
     else
     {
@@ -621,6 +881,7 @@ void type_register_private::method(const type& t, std::unique_ptr<method_wrapper
         auto m = create_item<::rttr::method>(meth.get());
         get_global_method_storage().insert(std::move(name), std::move(m));
         get_method_storage().push_back(std::move(meth));
+        ++get_method_generation();
     }
 }
 
@@ -667,14 +928,28 @@ property type_register_private::get_type_property(const type& t, string_view nam
 
 method type_register_private::get_type_method(const type& t, string_view name)
 {
-    for (const auto& meth : get_items_for_type(t, t.m_type_data->get_class_data().m_methods))
+    const auto& class_data = t.m_type_data->get_class_data();
+    // the index is not up to date, while the class items are not flattened
+    if (class_data.m_members_dirty.load(std::memory_order_acquire))
     {
-        if (meth.get_name() == name)
+        std::lock_guard<std::mutex> lock(get_class_members_mutex());
+        for (const auto& meth : get_items_for_type(t, class_data.m_methods))
         {
-            return meth;
+            if (meth.get_name() == name)
+                return meth;
         }
+
+        return create_invalid_item<::rttr::method>();
     }
 
+    auto meth = class_data.m_method_index.find(class_data.m_methods, generate_hash(name.data(), name.length()),
+                                               [&t, name](const ::rttr::method& item)
+                                               {
+                                                   return (item.get_declaring_type() == t && item.get_name() == name);
+                                               });
+    if (meth)
+        return *meth;
+
     return create_invalid_item<::rttr::method>();
 }
 
@@ -683,15 +958,30 @@ method type_register_private::get_type_method(const type& t, string_view name)
 method type_register_private::get_type_method(const type& t, string_view name,
                                               const std::vector<type>& type_list)
 {
-    for (const auto& meth : get_items_for_type(t, t.m_type_data->get_class_data().m_methods))
+    const auto& class_data = t.m_type_data->get_class_data();
+    // the index is not up to date, while the class items are not flattened
+    if (class_data.m_members_dirty.load(std::memory_order_acquire))
     {
-        if (meth.get_name() == name &&
-            compare_with_type_list::compare(meth.get_parameter_infos(), type_list))
+        std::lock_guard<std::mutex> lock(get_class_members_mutex());
+        for (const auto& meth : get_items_for_type(t, class_data.m_methods))
         {
-            return meth;
+            if (meth.get_name() == name && compare_with_type_list::compare(meth.get_parameter_infos(), type_list))
+                return meth;
         }
+
+        return create_invalid_item<::rttr::method>();
     }
 
+    auto meth = class_data.m_method_signature_index.find(class_data.m_methods, get_signature_hash(name, type_list),
+                                                         [&t, name, &type_list](const ::rttr::method& item)
+                                                         {
+                                                             return (item.get_declaring_type() == t &&
+                                                                     item.get_name() == name &&
+                                                                     compare_with_type_list::compare(item.get_parameter_infos(), type_list));
+                                                         });
+    if (meth)
+        return *meth;
+
     return detail::create_invalid_item<::rttr::method>();
 }
 
@@ -720,28 +1010,198 @@ void type_register_private::update_class_list(const type& t, T item_ptr)
     all_class_items.reserve(all_class_items.size() + item_vec.size());
     all_class_items.insert(all_class_items.end(), item_vec.begin(), item_vec.end());
 
-    // update derived types
-    for (const auto& derived_type : t.get_derived_classes())
-        update_class_list<T>(derived_type, item_ptr);
+    update_class_index(t.m_type_data->get_class_data(), item_ptr);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<type>& get_dirty_class_list()
+{
+    static std::vector<type> class_list;
+    return class_list;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::mark_class_members_dirty(const type& t)
+{
+    ++get_method_generation();
+
+    auto& data = t.m_type_data->get_class_data();
+    if (data.m_members_dirty)
+        return;
+
+    data.m_members_dirty = true;
+    get_dirty_class_list().push_back(t);
+
+    // the derived classes contain the items of this class as well
+    for (const auto& derived_type : data.m_derived_types)
+        mark_class_members_dirty(derived_type);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::update_class_members(const type& t)
+{
+    auto& data = t.m_type_data->get_class_data();
+    if (!data.m_members_dirty.load(std::memory_order_relaxed))
+        return;
+
+    update_class_list(t, &class_data::m_properties);
+    update_class_list(t, &class_data::m_methods);
+    data.m_members_dirty.store(false, std::memory_order_release);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
-template<typename T>
-RTTR_INLINE T* type_register_private::get_item_by_type(const type& t, const std::vector<data_container<T>>& vec)
+void type_register_private::update_dirty_classes()
 {
-    using vec_value_type = data_container<T>;
-    const auto id = t.get_id();
-    auto itr = std::lower_bound(vec.cbegin(), vec.cend(), id, typename vec_value_type::order_by_id());
-    for (; itr != vec.cend(); ++itr)
+    std::lock_guard<std::mutex> lock(get_class_members_mutex());
+    auto& class_list = get_dirty_class_list();
+    for (const auto& t : class_list)
+        update_class_members(t);
+
+    class_list.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+class_data& type_register_private::get_class_members(const type& t)
+{
+    // outside of a registration no class is dirty, so concurrent readers only pay for the atomic load
+    auto& data = t.m_type_data->get_class_data();
+    if (data.m_members_dirty.load(std::memory_order_acquire))
     {
-        auto& item = *itr;
-        if (item.m_id == id)
-            return item.m_data.get();
-        else
+        std::lock_guard<std::mutex> lock(get_class_members_mutex());
+        update_class_members(t);
+    }
+
+    return data;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::update_class_index(class_data& data, std::vector<::rttr::property> class_data::* item_ptr)
+{
+    const auto& property_list = data.*item_ptr;
+    std::vector<hash_index<::rttr::property>::entry> entries;
+    entries.reserve(property_list.size());
+
+    std::size_t index = 0;
+    for (const auto& prop : property_list)
+    {
+        const auto name = prop.get_name();
+        entries.emplace_back(generate_hash(name.data(), name.length()), index++);
+    }
+
+    data.m_property_index.rebuild(entries);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::update_class_index(class_data& data, std::vector<::rttr::method> class_data::* item_ptr)
+{
+    const auto& method_list = data.*item_ptr;
+    std::vector<hash_index<::rttr::method>::entry> name_entries;
+    std::vector<hash_index<::rttr::method>::entry> signature_entries;
+    name_entries.reserve(method_list.size());
+    signature_entries.reserve(method_list.size());
+
+    std::vector<std::size_t> signature_hashes;
+    std::size_t index = 0;
+    for (const auto& meth : method_list)
+    {
+        const auto name = meth.get_name();
+        name_entries.emplace_back(generate_hash(name.data(), name.length()), index);
+
+        signature_hashes.clear();
+        append_signature_hashes(meth, signature_hashes);
+        for (const auto hash_value : signature_hashes)
+            signature_entries.emplace_back(hash_value, index);
+
+        ++index;
+    }
+
+    data.m_method_index.rebuild(name_entries);
+    data.m_method_signature_index.rebuild(signature_entries);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::append_signature_hashes(const ::rttr::method& meth, std::vector<std::size_t>& hash_list)
+{
+    const auto name = meth.get_name();
+    auto seed = generate_hash(name.data(), name.length());
+
+    // the signature is hashed the same way as in 'get_signature_hash';
+    // every trailing parameter with a default value may be omitted at invocation,
+    // so the method is also indexed with these shorter signatures
+    std::size_t param_count = 0;
+    for (const auto& param : meth.get_parameter_infos())
+    {
+        if (param.has_default_value())
+            hash_list.push_back(hash_combine(seed, param_count));
+
+        seed = hash_combine(seed, param.get_type().get_id());
+        ++param_count;
+    }
+    hash_list.push_back(hash_combine(seed, param_count));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t type_register_private::get_signature_hash(string_view name, const std::vector<type>& type_list)
+{
+    auto seed = generate_hash(name.data(), name.length());
+    for (const auto& t : type_list)
+        seed = hash_combine(seed, t.get_id());
+
+    return hash_combine(seed, type_list.size());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t type_register_private::get_signature_hash(string_view name, const argument_range& args)
+{
+    auto seed = generate_hash(name.data(), name.length());
+    for (const auto& arg : args)
+        seed = hash_combine(seed, arg.get_type().get_id());
+
+    return hash_combine(seed, args.size());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const ::rttr::method* type_register_private::find_method(const type& raw_type, string_view name, const argument_range& args)
+{
+    if (const auto snapshot = registry_snapshot::get(raw_type))
+        return snapshot->find_method(raw_type, name, args);
+
+    const auto& class_data = get_class_members(raw_type);
+    return class_data.m_method_signature_index.find(class_data.m_methods, get_signature_hash(name, args),
+                                                    [name, &args](const ::rttr::method& item)
+                                                    {
+                                                        return (item.get_name() == name &&
+                                                                compare_with_arg_list::compare(item.get_parameter_infos(), args));
+                                                    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const ::rttr::method* type_register_private::find_global_method(string_view name, const argument_range& args)
+{
+    auto& meth_list = get_global_method_storage();
+    auto itr = meth_list.find(name);
+    while (itr != meth_list.end())
+    {
+        const auto& meth = *itr;
+        if (meth.get_name() != name)
             break;
+
+        if (compare_with_arg_list::compare(meth.get_parameter_infos(), args))
+            return &meth;
+
+        ++itr;
     }
 
     return nullptr;
@@ -749,16 +1209,39 @@ RTTR_INLINE T* type_register_private::get_item_by_type(const type& t, const std:
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+std::atomic<std::size_t>& type_register_private::get_method_generation() RTTR_NOEXCEPT
+{
+    static std::atomic<std::size_t> generation(0);
+    return generation;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE T* type_register_private::get_item_by_type(const type& t, const type_id_table<T>& table)
+{
+    const auto id = t.get_id();
+    return (id < table.size() ? table[id].get() : nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 template<typename T>
 RTTR_INLINE void type_register_private::register_item_type(const type& t, std::unique_ptr<T> new_item,
-                                                           std::vector<data_container<T>>& vec)
+                                                           type_id_table<T>& table)
 {
     if (!t.is_valid())
         return;
 
-    using data_type = data_container<T>;
-    vec.push_back({t.get_id(), std::move(new_item)});
-    std::stable_sort(vec.begin(), vec.end(), typename data_type::order_by_id());
+    const auto id = t.get_id();
+    if (id >= table.size())
+        table.resize(static_cast<std::size_t>(id) + 1);
+
+    // the first registered item wins
+    if (!table[id])
+        table[id] = std::move(new_item);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -805,128 +1288,294 @@ void type_register_private::register_metadata( const type& t, std::vector<metada
 
 /////////////////////////////////////////////////////////////////////////////////////
 
+static std::vector<std::unique_ptr<type_converter_base>>& get_converter_storage()
+{
+    static std::vector<std::unique_ptr<type_converter_base>> container;
+    return container;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+struct order_converter_by_target_id
+{
+    RTTR_INLINE bool operator()(const type_converter_base* converter, type::type_id target_id) const
+    {
+        return (converter->m_target_type.get_id() < target_id);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Keeps the converter paths of \ref type_register_private::create_converter_paths() alive;
+ * outdated paths and chains are not deleted, because they might be still in use.
+ */
+struct converter_path_storage
+{
+    std::mutex                                                          m_mutex;
+    std::vector<std::unique_ptr<std::vector<const type_converter_base*>>> m_paths;
+    std::vector<std::unique_ptr<type_converter_base>>                   m_chains;
+};
+
+static converter_path_storage& get_converter_path_storage()
+{
+    static converter_path_storage storage;
+    return storage;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+const type_register_private::conversion_data* type_register_private::get_conversion_data(const type& t)
+{
+    return get_item_by_type(t, get_conversion_data_list());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+type_register_private::conversion_data& type_register_private::get_or_create_conversion_data(const type& t)
+{
+    auto& table = get_conversion_data_list();
+    const auto id = t.get_id();
+    if (id >= table.size())
+        table.resize(static_cast<std::size_t>(id) + 1);
+
+    if (!table[id])
+        table[id] = detail::make_unique<conversion_data>();
+
+    return *table[id];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
 void type_register_private::converter(const type& t, std::unique_ptr<type_converter_base> converter)
 {
     if (!t.is_valid())
         return;
 
-    if (get_converter(t, converter->m_target_type))
+    if (get_direct_converter(t, converter->m_target_type))
         return;
 
-    using vec_value_type = data_container<type_converter_base>;
-    auto& container = get_type_converter_list();
-    container.push_back({t.get_id(), std::move(converter)});
-    std::stable_sort(container.begin(), container.end(), vec_value_type::order_by_id());
+    auto& converter_list = get_or_create_conversion_data(t).m_converters;
+    const auto itr = std::lower_bound(converter_list.begin(), converter_list.end(), converter->m_target_type.get_id(),
+                                      order_converter_by_target_id());
+    converter_list.insert(itr, converter.get());
+    get_converter_storage().push_back(std::move(converter));
+
+    // the new converter might create new or shorter paths from every type
+    std::lock_guard<std::mutex> lock(get_converter_path_storage().m_mutex);
+    for (const auto& data : get_conversion_data_list())
+    {
+        if (data)
+            data->m_converter_paths.store(nullptr, std::memory_order_release);
+    }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
 void type_register_private::comparator(const type& t, const type_comparator_base* comparator)
 {
-    if (!t.is_valid())
-        return;
-
-    using data_type = data_container<const type_comparator_base*>;
-    auto& container = get_type_comparator_list();
-    container.push_back({t.get_id(), comparator});
-    std::stable_sort(container.begin(), container.end(),
-                     data_type::order_by_id());
+    register_comparator_impl(t, comparator, &conversion_data::m_comparator);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
 const type_converter_base* type_register_private::get_converter(const type& source_type, const type& target_type)
 {
-    const auto src_id = source_type.get_id();
+    if (const auto converter = get_direct_converter(source_type, target_type))
+        return converter;
+
+    // without any registered converter there cannot be a path
+    const auto data = get_conversion_data(source_type);
+    if (!data || data->m_converters.empty())
+        return nullptr;
+
+    return find_converter_path(source_type, target_type);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+const type_converter_base* type_register_private::get_direct_converter(const type& source_type, const type& target_type)
+{
+    const auto data = get_conversion_data(source_type);
+    if (!data)
+        return nullptr;
+
+    const auto& converter_list = data->m_converters;
     const auto target_id = target_type.get_id();
-    using vec_value_type = data_container<type_converter_base>;
-    auto& container = get_type_converter_list();
-    auto itr = std::lower_bound(container.cbegin(), container.cend(),
-                                src_id, vec_value_type::order_by_id());
-    for (; itr != container.cend(); ++itr)
+    const auto itr = std::lower_bound(converter_list.begin(), converter_list.end(), target_id,
+                                      order_converter_by_target_id());
+    if (itr != converter_list.end() && (*itr)->m_target_type.get_id() == target_id)
+        return *itr;
+
+    return nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+const type_converter_base* type_register_private::find_converter_path(const type& source_type, const type& target_type)
+{
+    if (source_type == target_type || !target_type.is_valid())
+        return nullptr;
+
+    const auto data = get_conversion_data(source_type);
+    if (!data)
+        return nullptr;
+
+    // the paths are created once per source type; afterwards the lookup needs no lock
+    auto path_list = data->m_converter_paths.load(std::memory_order_acquire);
+    if (!path_list)
+        path_list = create_converter_paths(source_type, *data);
+
+    const auto target_id = target_type.get_id();
+    const auto itr = std::lower_bound(path_list->begin(), path_list->end(), target_id, order_converter_by_target_id());
+    if (itr != path_list->end() && (*itr)->m_target_type.get_id() == target_id)
+        return *itr;
+
+    return nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<const type_converter_base*>* type_register_private::create_converter_paths(const type& source_type,
+                                                                                              const conversion_data& data)
+{
+    auto& storage = get_converter_path_storage();
+    std::lock_guard<std::mutex> lock(storage.m_mutex);
+
+    // another thread might have created the paths in the meantime
+    if (const auto path_list = data.m_converter_paths.load(std::memory_order_acquire))
+        return path_list;
+
+    // breadth first search over the registered converters, so the path with the fewest conversions is found
+    // for every reachable type; every expansion only visits the converters registered for the current type;
+    // for every reached type we store the converter, which was used to reach it, and the type it was reached from
+    struct path_step
     {
-        auto& item = *itr;
-        if (item.m_id != src_id)
-            break; // type not found
+        type::type_id               m_source_id;
+        const type_converter_base*  m_converter;
+    };
+    std::unordered_map<type::type_id, path_step> predecessor;
+    std::vector<type> queue = { source_type };
+    predecessor.emplace(source_type.get_id(), path_step{ source_type.get_id(), nullptr });
+    for (std::size_t index = 0; index < queue.size(); ++index)
+    {
+        const type current_type = queue[index];
+        const auto current_data = get_conversion_data(current_type);
+        if (!current_data)
+            continue;
 
-        if (item.m_data->m_target_type.get_id() == target_id)
-            return item.m_data.get();
+        for (const auto converter : current_data->m_converters)
+        {
+            if (predecessor.emplace(converter->m_target_type.get_id(), path_step{ current_type.get_id(), converter }).second)
+                queue.push_back(converter->m_target_type);
+        }
     }
 
-    return nullptr;
+    auto path_list = detail::make_unique<std::vector<const type_converter_base*>>();
+    path_list->reserve(queue.size() - 1);
+    for (std::size_t index = 1; index < queue.size(); ++index)
+    {
+        std::vector<const type_converter_base*> path;
+        for (auto id = queue[index].get_id(); id != source_type.get_id(); )
+        {
+            const auto& step = predecessor[id];
+            path.push_back(step.m_converter);
+            id = step.m_source_id;
+        }
+
+        if (path.size() == 1)
+        {
+            path_list->push_back(path.front());
+        }
+        else
+        {
+            std::reverse(path.begin(), path.end());
+            storage.m_chains.push_back(detail::make_unique<type_converter_chain>(std::move(path)));
+            path_list->push_back(storage.m_chains.back().get());
+        }
+    }
+
+    std::sort(path_list->begin(), path_list->end(),
+              [](const type_converter_base* lhs, const type_converter_base* rhs)
+              { return (lhs->m_target_type.get_id() < rhs->m_target_type.get_id()); });
+
+    const auto result = path_list.get();
+    storage.m_paths.push_back(std::move(path_list));
+    data.m_converter_paths.store(result, std::memory_order_release);
+    return result;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
 const type_comparator_base* type_register_private::get_comparator(const type& t)
 {
-    using vec_value_type = data_container<const type_comparator_base*>;
-    const auto id = t.get_id();
-    auto& container = get_type_comparator_list();
-    auto itr = std::lower_bound(container.cbegin(), container.cend(), id,
-                                vec_value_type::order_by_id());
-    if (itr != container.cend() && itr->m_id == id)
-        return itr->m_data;
-    else
-        return nullptr;
+    const auto data = get_conversion_data(t);
+    return (data ? data->m_comparator : nullptr);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
 const type_comparator_base* type_register_private::get_equal_comparator(const type& t)
 {
-    return get_type_comparator_impl(t, get_type_equal_comparator_list());
+    const auto data = get_conversion_data(t);
+    return (data ? data->m_equal_comparator : nullptr);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
 const type_comparator_base* type_register_private::get_less_than_comparator(const type& t)
 {
-    return get_type_comparator_impl(t, get_type_less_comparator_list());
+    const auto data = get_conversion_data(t);
+    return (data ? data->m_less_than_comparator : nullptr);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
-const type_comparator_base*
-type_register_private::get_type_comparator_impl(const type& t,
-                                                const std::vector<type_register_private::data_container<const type_comparator_base*>>& comparator_list)
- {
-    using vec_value_type = data_container<const type_comparator_base*>;
-    const auto id = t.get_id();
-    auto itr = std::lower_bound(comparator_list.cbegin(), comparator_list.cend(), id,
-                                vec_value_type::order_by_id());
-    if (itr != comparator_list.cend() && itr->m_id == id)
-        return itr->m_data;
-    else
-        return nullptr;
- }
-
-/////////////////////////////////////////////////////////////////////////////////////
-
 void type_register_private::equal_comparator(const type& t, const type_comparator_base* comparator)
 {
-    register_comparator_impl(t, comparator, get_type_equal_comparator_list());
+    register_comparator_impl(t, comparator, &conversion_data::m_equal_comparator);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
 void type_register_private::less_than_comparator(const type& t, const type_comparator_base* comparator)
 {
-    register_comparator_impl(t, comparator, get_type_less_comparator_list());
+    register_comparator_impl(t, comparator, &conversion_data::m_less_than_comparator);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
 void type_register_private::register_comparator_impl(const type& t, const type_comparator_base* comparator,
-                                                     std::vector<data_container<const type_comparator_base*>>& comparator_list)
+                                                     const type_comparator_base* conversion_data::* comparator_ptr)
+{
+    if (!t.is_valid())
+        return;
+
+    // the first registered comparator wins
+    auto& data = get_or_create_conversion_data(t);
+    if (!(data.*comparator_ptr))
+        data.*comparator_ptr = comparator;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+const type_hasher_base* type_register_private::get_hasher(const type& t)
+{
+    const auto data = get_conversion_data(t);
+    return (data ? data->m_hasher : nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::hasher(const type& t, const type_hasher_base* hasher)
 {
     if (!t.is_valid())
         return;
 
-    using data_type = data_container<const type_comparator_base*>;
-    comparator_list.push_back({t.get_id(), comparator});
-    std::stable_sort(comparator_list.begin(), comparator_list.end(),
-                     data_type::order_by_id());
+    // the first registered hasher wins
+    auto& data = get_or_create_conversion_data(t);
+    if (!data.m_hasher)
+        data.m_hasher = hasher;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
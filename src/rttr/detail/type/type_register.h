@@ -56,6 +56,7 @@ class property_wrapper_base;
 
 struct type_converter_base;
 struct type_comparator_base;
+struct type_hasher_base;
 struct base_class_info;
 struct derived_info;
 
@@ -103,15 +104,29 @@ public:
 
     static void less_than_comparator(const type& t, type_comparator_base* comparator);
 
+    static void hasher(const type& t, type_hasher_base* hasher);
+
     static void register_base_class(const type& derived_type, const base_class_info& base_info);
 
+    /*!
+     * \brief Until the matching call of \ref end_bulk_registration(), new registered type names
+     *        are not sorted immediately into the registry, but all at once at the end.
+     *        The inherited properties and methods of the changed classes are also flattened only once at the end.
+     *        Custom names are applied to the derived types, e.g. pointers, also only once at the end.
+     *
+     * \remark The calls can be nested, only the outermost call of \ref end_bulk_registration() will sort.
+     */
+    static void begin_bulk_registration();
+
+    static void end_bulk_registration();
+
     /*!
      * \brief Register the type info for the given name
      *
      * \remark When a type with the given name is already registered,
      *         then the type for the already registered type will be returned.
      *
-     * \return A valid type object.
+     * \return A valid type object, or an invalid type, when all type ids are already in use.
      */
     static type type_reg(type_data& info) RTTR_NOEXCEPT;
 
@@ -125,6 +140,19 @@ private:
     friend struct detail::type_getter;
 };
 
+/*!
+ * This class will start a bulk registration for its lifetime.
+ * It is used for the registration code inside the \ref RTTR_REGISTRATION macro.
+ */
+struct bulk_registration
+{
+    bulk_registration() { type_register::begin_bulk_registration(); }
+    ~bulk_registration() { type_register::end_bulk_registration(); }
+
+    bulk_registration(const bulk_registration&) = delete;
+    bulk_registration& operator=(const bulk_registration&) = delete;
+};
+
 } // end namespace detail
 } // end namespace rttr
 
@@ -33,10 +33,12 @@
 #include "rttr/detail/misc/flat_map.h"
 #include "rttr/enumeration.h"
 #include "rttr/variant.h"
+#include "rttr/argument_range.h"
 #include "rttr/detail/metadata/metadata.h"
 
 #include "rttr/string_view.h"
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -46,6 +48,7 @@ namespace rttr
 class type;
 class property;
 class method;
+class argument;
 
 namespace detail
 {
@@ -57,6 +60,7 @@ class method_wrapper_base;
 class enumeration_wrapper_base;
 
 struct type_data;
+struct class_data;
 
 /*!
  * This class contains all logic to register properties, methods etc.. for a specific type.
@@ -84,6 +88,10 @@ public:
     static flat_map<string_view, type>& get_orig_name_to_id();
     static flat_map<std::string, type, hash>& get_custom_name_to_id();
 
+    static type get_type_by_name(string_view name);
+    //! Returns the type, whose name has the hash value \p hash_value; see \ref generate_hash()
+    static type get_type_by_name_hash(std::size_t hash_value);
+
     /////////////////////////////////////////////////////////////////////////////////////
 
     static void register_enumeration(const type& t, std::unique_ptr<enumeration_wrapper_base> enum_data);
@@ -92,74 +100,98 @@ public:
     static void comparator(const type& t, const type_comparator_base* comparator);
     static void equal_comparator(const type& t, const type_comparator_base* comparator);
     static void less_than_comparator(const type& t, const type_comparator_base* comparator);
+    static void hasher(const type& t, const type_hasher_base* hasher);
 
     /////////////////////////////////////////////////////////////////////////////////////
 
+    //! Returns the registered converter or a chain of registered converters, which converts \p source_type to \p target_type.
     static const type_converter_base* get_converter(const type& source_type, const type& target_type);
+    static const type_converter_base* get_direct_converter(const type& source_type, const type& target_type);
+    //! Searches the shortest path of registered converters from \p source_type to \p target_type; the result is cached.
+    static const type_converter_base* find_converter_path(const type& source_type, const type& target_type);
     static const type_comparator_base* get_comparator(const type& t);
     static const type_comparator_base* get_equal_comparator(const type& t);
     static const type_comparator_base* get_less_than_comparator(const type& t);
+    static const type_hasher_base* get_hasher(const type& t);
     static variant get_metadata(const type& t, const variant& key);
     static enumeration get_enumeration(const type& t);
 
     /////////////////////////////////////////////////////////////////////////////////////
 
+    static std::size_t get_signature_hash(string_view name, const std::vector<type>& type_list);
+    static std::size_t get_signature_hash(string_view name, const argument_range& args);
+    //! Returns the method named \p name of the class \p raw_type, which can be invoked with \p args; otherwise a `nullptr`.
+    static const ::rttr::method* find_method(const type& raw_type, string_view name, const argument_range& args);
+    //! Returns the global method named \p name, which can be invoked with \p args; otherwise a `nullptr`.
+    static const ::rttr::method* find_global_method(string_view name, const argument_range& args);
+    //! Returns a counter, which is increased whenever the method found for a name and argument list could change;
+    //! it is increased with sequential consistency and should be read with acquire semantic.
+    static std::atomic<std::size_t>& get_method_generation() RTTR_NOEXCEPT;
+    //! Appends the hashes of all signatures, which can be used to invoke the method \p meth.
+    static void append_signature_hashes(const ::rttr::method& meth, std::vector<std::size_t>& hash_list);
+
+    static void register_base_type_set(class_data& derived_data, const type& base_type);
+    static void update_conversion_index(class_data& data);
+
+    static void begin_bulk_registration();
+    static void end_bulk_registration();
+    //! Derives the names of the types, whose raw type got a custom name, and fills the name container again.
+    static void update_custom_names();
+
+    //! Marks the flattened items of the class \p t and of all its derived classes as outdated.
+    static void mark_class_members_dirty(const type& t);
+    static void update_class_members(const type& t);
+    static void update_dirty_classes();
+    //! Returns the class data of \p t with up to date flattened properties and methods.
+    static class_data& get_class_members(const type& t);
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
 private:
 
-    template<typename T, typename Data_Type = conditional_t<std::is_pointer<T>::value, T, std::unique_ptr<T>>>
-    struct data_container
+    //! A side table, which stores for every type id at most one item; its size is the highest used id + 1.
+    template<typename T>
+    using type_id_table = std::vector<std::unique_ptr<T>>;
+
+    /*!
+     * The registered converters, comparators and the hasher of a type; they are not part of 'class_data',
+     * because their types are not exported from the library.
+     */
+    struct conversion_data
     {
-        data_container(type::type_id id) : m_id(id) {}
-        data_container(type::type_id id, Data_Type data) : m_id(id), m_data(std::move(data)) {}
-        data_container(data_container<T, Data_Type>&& other) : m_id(other.m_id), m_data(std::move(other.m_data)) {}
-        data_container<T, Data_Type>& operator = (data_container<T, Data_Type>&& other)
-        {
-            m_id = other.m_id;
-            m_data = std::move(other.m_data);
-            return *this;
-        }
-
-        struct order_by_id
-        {
-            RTTR_INLINE bool operator () ( const data_container<T>& _left, const data_container<T>& _right )  const
-            {
-                return _left.m_id < _right.m_id;
-            }
-            RTTR_INLINE bool operator () ( const type::type_id& _left, const data_container<T>& _right ) const
-            {
-                return _left < _right.m_id;
-            }
-            RTTR_INLINE bool operator () ( const data_container<T>& _left, const type::type_id& _right ) const
-            {
-                return _left.m_id < _right;
-            }
-        };
-
-        type::type_id   m_id;
-        Data_Type       m_data;
+        conversion_data() : m_converter_paths(nullptr), m_comparator(nullptr), m_equal_comparator(nullptr),
+                            m_less_than_comparator(nullptr), m_hasher(nullptr) {}
+
+        //! the registered converters of this type, sorted by the id of their target type
+        std::vector<const type_converter_base*> m_converters;
+        //! the shortest converter path to every reachable type, sorted by the id of the target type;
+        //! it is created by the first path search and published with release semantic
+        mutable std::atomic<const std::vector<const type_converter_base*>*> m_converter_paths;
+        const type_comparator_base* m_comparator;
+        const type_comparator_base* m_equal_comparator;
+        const type_comparator_base* m_less_than_comparator;
+        const type_hasher_base*     m_hasher;
     };
 
     template<typename T>
-    static RTTR_INLINE T* get_item_by_type(const type& t, const std::vector<data_container<T>>& vec);
+    static RTTR_INLINE T* get_item_by_type(const type& t, const type_id_table<T>& table);
     template<typename T>
-    static RTTR_INLINE void register_item_type(const type& t, std::unique_ptr<T> new_item, std::vector<data_container<T>>& vec);
+    static RTTR_INLINE void register_item_type(const type& t, std::unique_ptr<T> new_item, type_id_table<T>& table);
 
     static std::vector<metadata>* get_metadata_list(const type& t);
     static variant get_metadata(const variant& key, const std::vector<metadata>& data);
 
-    static std::vector<data_container<type_converter_base>>& get_type_converter_list();
-    static std::vector<data_container<const type_comparator_base*>>& get_type_comparator_list();
-
-    static std::vector<data_container<const type_comparator_base*>>& get_type_equal_comparator_list();
-    static std::vector<data_container<const type_comparator_base*>>& get_type_less_comparator_list();
-
-    static std::vector<data_container<enumeration_wrapper_base>>& get_enumeration_list();
-    static std::vector<data_container<std::vector<metadata>>>& get_metadata_type_list();
+    static type_id_table<enumeration_wrapper_base>& get_enumeration_list();
+    static type_id_table<std::vector<metadata>>& get_metadata_type_list();
+    static type_id_table<conversion_data>& get_conversion_data_list();
+    //! Returns the conversion data of \p t, when a converter, comparator or hasher was registered for it; otherwise a `nullptr`.
+    static const conversion_data* get_conversion_data(const type& t);
+    static conversion_data& get_or_create_conversion_data(const type& t);
+    static const std::vector<const type_converter_base*>* create_converter_paths(const type& source_type,
+                                                                                 const conversion_data& data);
 
     static void register_comparator_impl(const type& t, const type_comparator_base* comparator,
-                                         std::vector<data_container<const type_comparator_base*>>& comparator_list);
-    static const type_comparator_base* get_type_comparator_impl(const type& t,
-                                                                const std::vector<data_container<const type_comparator_base*>>& comparator_list);
+                                         const type_comparator_base* conversion_data::* comparator_ptr);
 
     static ::rttr::property get_type_property(const type& t, string_view name);
     static ::rttr::method get_type_method(const type& t, string_view name);
@@ -168,12 +200,14 @@ private:
 
     template<typename T>
     static void update_class_list(const type& t, T item_ptr);
+    static void update_class_index(class_data& data, std::vector<::rttr::property> class_data::* item_ptr);
+    static void update_class_index(class_data& data, std::vector<::rttr::method> class_data::* item_ptr);
 
     static std::string derive_name(const type_data& wrapper_type,
                                    const type_data& array_raw_type,
                                    string_view name);
     //! Returns true, when the name was already registered
-    static bool register_name(uint16_t& id, type_data& info);
+    static bool register_name(type::type_id& id, type_data& info);
     static void register_base_class_info(type_data& info);
 
 };
@@ -98,5 +98,154 @@ bool variant_compare_less(const variant& lhs, const type& lhs_type, const varian
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename L, typename R, typename Enable = void>
+struct builtin_compare
+{
+    static RTTR_CONSTEXPR builtin_compare_func get_equal() { return nullptr; }
+    static RTTR_CONSTEXPR builtin_compare_func get_less()  { return nullptr; }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+struct builtin_compare<T, T>
+{
+    static bool equal(const void* lhs, const void* rhs)
+    {
+        return (*static_cast<const T*>(lhs) == *static_cast<const T*>(rhs));
+    }
+
+    static bool less(const void* lhs, const void* rhs)
+    {
+        return (*static_cast<const T*>(lhs) < *static_cast<const T*>(rhs));
+    }
+
+    static RTTR_CONSTEXPR builtin_compare_func get_equal() { return &equal; }
+    static RTTR_CONSTEXPR builtin_compare_func get_less()  { return &less; }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// two different arithmetic types are compared, like in 'variant_compare_equal' and 'variant_compare_less',
+// as 'double' when one of them is a floating point type, otherwise as 'int64_t'
+template<typename L, typename R>
+struct builtin_compare<L, R, enable_if_t<!std::is_same<L, R>::value && std::is_arithmetic<L>::value && std::is_arithmetic<R>::value>>
+{
+    using compare_type = conditional_t<std::is_floating_point<L>::value || std::is_floating_point<R>::value, double, int64_t>;
+
+    template<typename T>
+    static RTTR_INLINE compare_type get_value(const void* value)
+    {
+        // a failed conversion yields '0', like 'variant::to_double()' and 'variant::to_int64()'
+        compare_type result = 0;
+        convert_from<T>::to(*static_cast<const T*>(value), result);
+        return result;
+    }
+
+    static RTTR_INLINE bool is_equal(double lhs, double rhs)    { return almost_equal(lhs, rhs); }
+    static RTTR_INLINE bool is_equal(int64_t lhs, int64_t rhs)  { return (lhs == rhs); }
+
+    static bool equal(const void* lhs, const void* rhs)
+    {
+        return is_equal(get_value<L>(lhs), get_value<R>(rhs));
+    }
+
+    static bool less(const void* lhs, const void* rhs)
+    {
+        return (get_value<L>(lhs) < get_value<R>(rhs));
+    }
+
+    static RTTR_CONSTEXPR builtin_compare_func get_equal() { return &equal; }
+    static RTTR_CONSTEXPR builtin_compare_func get_less()  { return &less; }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+#define RTTR_BUILTIN_COMPARE_ROW(L, func)                                                   \
+    {                                                                                       \
+        nullptr,                                                                            \
+        builtin_compare<L, bool>::func(),                                                   \
+        builtin_compare<L, char>::func(),                                                   \
+        builtin_compare<L, int8_t>::func(),                                                 \
+        builtin_compare<L, int16_t>::func(),                                                \
+        builtin_compare<L, int32_t>::func(),                                                \
+        builtin_compare<L, int64_t>::func(),                                                \
+        builtin_compare<L, uint8_t>::func(),                                                \
+        builtin_compare<L, uint16_t>::func(),                                               \
+        builtin_compare<L, uint32_t>::func(),                                               \
+        builtin_compare<L, uint64_t>::func(),                                               \
+        builtin_compare<L, float>::func(),                                                  \
+        builtin_compare<L, double>::func(),                                                 \
+        builtin_compare<L, std::string>::func()                                             \
+    }
+
+#define RTTR_BUILTIN_COMPARE_MATRIX(func)                                                   \
+    {                                                                                       \
+        { nullptr },                                                                        \
+        RTTR_BUILTIN_COMPARE_ROW(bool, func),                                               \
+        RTTR_BUILTIN_COMPARE_ROW(char, func),                                               \
+        RTTR_BUILTIN_COMPARE_ROW(int8_t, func),                                             \
+        RTTR_BUILTIN_COMPARE_ROW(int16_t, func),                                            \
+        RTTR_BUILTIN_COMPARE_ROW(int32_t, func),                                            \
+        RTTR_BUILTIN_COMPARE_ROW(int64_t, func),                                            \
+        RTTR_BUILTIN_COMPARE_ROW(uint8_t, func),                                            \
+        RTTR_BUILTIN_COMPARE_ROW(uint16_t, func),                                           \
+        RTTR_BUILTIN_COMPARE_ROW(uint32_t, func),                                           \
+        RTTR_BUILTIN_COMPARE_ROW(uint64_t, func),                                           \
+        RTTR_BUILTIN_COMPARE_ROW(float, func),                                              \
+        RTTR_BUILTIN_COMPARE_ROW(double, func),                                             \
+        RTTR_BUILTIN_COMPARE_ROW(std::string, func)                                         \
+    }
+
+static RTTR_CONSTEXPR_OR_CONST std::size_t builtin_type_count = static_cast<std::size_t>(builtin_type::BUILTIN_TYPE_COUNT);
+
+// the rows are the types of the left hand side, the columns the types of the right hand side;
+// the order has to match the declaration order of 'builtin_type'
+static const builtin_compare_func equal_compare_matrix[builtin_type_count][builtin_type_count] = RTTR_BUILTIN_COMPARE_MATRIX(get_equal);
+static const builtin_compare_func less_compare_matrix[builtin_type_count][builtin_type_count]  = RTTR_BUILTIN_COMPARE_MATRIX(get_less);
+
+#undef RTTR_BUILTIN_COMPARE_MATRIX
+#undef RTTR_BUILTIN_COMPARE_ROW
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+builtin_compare_func get_builtin_equal_compare(builtin_type lhs, builtin_type rhs) RTTR_NOEXCEPT
+{
+    return equal_compare_matrix[static_cast<std::size_t>(lhs)][static_cast<std::size_t>(rhs)];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+builtin_compare_func get_builtin_less_compare(builtin_type lhs, builtin_type rhs) RTTR_NOEXCEPT
+{
+    return less_compare_matrix[static_cast<std::size_t>(lhs)][static_cast<std::size_t>(rhs)];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool compare_enum_with_integral_equal(builtin_type lhs_kind, builtin_type lhs_enum_kind, const void* lhs,
+                                      builtin_type rhs_kind, builtin_type rhs_enum_kind, const void* rhs,
+                                      bool& result)
+{
+    if ((lhs_enum_kind == builtin_type::none) == (rhs_enum_kind == builtin_type::none))
+        return false;
+
+    const builtin_type lhs_int_kind = (lhs_enum_kind != builtin_type::none) ? lhs_enum_kind : lhs_kind;
+    const builtin_type rhs_int_kind = (rhs_enum_kind != builtin_type::none) ? rhs_enum_kind : rhs_kind;
+    if (!is_integral_builtin_type(lhs_int_kind) || !is_integral_builtin_type(rhs_int_kind))
+        return false;
+
+    int64_t lhs_value = 0;
+    int64_t rhs_value = 0;
+    if (!get_builtin_conversion(lhs_int_kind, builtin_type::int64)(lhs, &lhs_value) ||
+        !get_builtin_conversion(rhs_int_kind, builtin_type::int64)(rhs, &rhs_value))
+        return false;
+
+    result = (lhs_value == rhs_value);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace detail
 } // end namespace rttr
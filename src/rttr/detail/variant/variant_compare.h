@@ -29,6 +29,7 @@
 #define RTTR_VARIANT_COMPARE_LESS_H_
 
 #include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/conversion/builtin_conversion.h"
 
 namespace rttr
 {
@@ -49,6 +50,43 @@ RTTR_API bool variant_compare_less(const variant& lhs, const type& lhs_type, con
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+/*!
+ * Compares the value \p lhs of one built-in type with the value \p rhs of another built-in type.
+ */
+using builtin_compare_func = bool (*)(const void* lhs, const void* rhs);
+
+/*!
+ * \brief Returns the function, which checks a value of the built-in type \p lhs and a value of the built-in type \p rhs
+ *        for equality, with the same result as \ref variant::operator==(); or a `nullptr`,
+ *        when this comparison needs a conversion to another type, e.g. between a `std::string` and an arithmetic type.
+ */
+RTTR_API builtin_compare_func get_builtin_equal_compare(builtin_type lhs, builtin_type rhs) RTTR_NOEXCEPT;
+
+/*!
+ * \brief Returns the function, which checks whether a value of the built-in type \p lhs is *less than*
+ *        a value of the built-in type \p rhs, with the same result as \ref variant::operator<(); or a `nullptr`,
+ *        when this comparison needs a conversion to another type, e.g. between a `std::string` and an arithmetic type.
+ */
+RTTR_API builtin_compare_func get_builtin_less_compare(builtin_type lhs, builtin_type rhs) RTTR_NOEXCEPT;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Checks an enumeration and an integral value for equality, by comparing the underlying value of the enumeration.
+ *
+ * \p lhs_kind and \p rhs_kind are the built-in types of the values \p lhs and \p rhs;
+ * \p lhs_enum_kind and \p rhs_enum_kind are the built-in types of their underlying types,
+ * or `none`, when the value is not an enumeration.
+ *
+ * \return `True`, when exactly one value is an enumeration and the other one an integral value;
+ *         then \p result contains the result of the comparison. Otherwise `false`.
+ */
+RTTR_LOCAL bool compare_enum_with_integral_equal(builtin_type lhs_kind, builtin_type lhs_enum_kind, const void* lhs,
+                                                 builtin_type rhs_kind, builtin_type rhs_enum_kind, const void* rhs,
+                                                 bool& result);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace detail
 } // end namespace rttr
 
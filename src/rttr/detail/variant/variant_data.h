@@ -44,10 +44,17 @@ using variant_basic_types = type_list<bool,
                                       long int, unsigned long int, long long int,
                                       unsigned long long int, float, double, void*>;
 
+static_assert(RTTR_VARIANT_STORAGE_SIZE % sizeof(void*) == 0 && RTTR_VARIANT_STORAGE_SIZE <= 64,
+              "The variant storage size has to be a multiple of the pointer size and not bigger than 64 bytes.");
+
 /*!
  * This is the data storage for the \ref variant class.
+ *
+ * It has at least the size of the basic types; this can be raised with the CMake option VARIANT_STORAGE_SIZE,
+ * so that bigger types, like `std::string`, are placed inside the variant without allocating memory.
  */
-using variant_data = std::aligned_storage<max_sizeof_list<variant_basic_types>::value,
+using variant_data = std::aligned_storage<(RTTR_VARIANT_STORAGE_SIZE > max_sizeof_list<variant_basic_types>::value) ?
+                                          RTTR_VARIANT_STORAGE_SIZE : max_sizeof_list<variant_basic_types>::value,
                                           max_alignof_list<variant_basic_types>::value>::type;
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,7 @@
 
 #include "rttr/detail/misc/misc_type_traits.h"
 #include "rttr/detail/variant/variant_data.h"
+#include "rttr/detail/variant/variant_memory.h"
 #include "rttr/detail/misc/argument_wrapper.h"
 #include "rttr/detail/variant_array_view/variant_array_view_creator.h"
 #include "rttr/detail/variant_associative_view/variant_associative_view_creator.h"
@@ -109,6 +110,17 @@ using variant_policy = conditional_t<std::is_same<T, void_variant_type>::value,
                                                   >
                                     >;
 
+/*!
+ * The type of the value, which is stored by the \ref variant_policy of \p T;
+ * this is the type returned for the operation `variant_policy_operation::GET_TYPE`.
+ */
+template<typename T>
+using variant_policy_held_type = conditional_t<std::is_same<T, void_variant_type>::value,
+                                               void,
+                                               conditional_t<is_one_dim_char_array<T>::value,
+                                                             std::string,
+                                                             T>>;
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
 /*!
@@ -325,6 +337,10 @@ struct variant_data_base_policy
                 }
                 else
                 {
+                    bool result = false;
+                    if (lhs.compare_builtin(lhs_type, rhs, rhs_type, false, result))
+                        return result;
+
                     if (is_lhs_arithmetic && rhs_type.is_arithmetic())
                     {
                         return variant_compare_equal(lhs, lhs_type, rhs, rhs_type);
@@ -356,6 +372,10 @@ struct variant_data_base_policy
                 }
                 else
                 {
+                    bool is_less = false;
+                    if (lhs.compare_builtin(lhs_type, rhs, rhs_type, true, is_less))
+                        return is_less;
+
                     return variant_compare_less(lhs, lhs_type, rhs, rhs_type);
                 }
 
@@ -397,7 +417,7 @@ struct variant_data_policy_small : variant_data_base_policy<T, variant_data_poli
 
     static RTTR_INLINE void swap(T& value, variant_data& dest)
     {
-        new (&dest) T(value);
+        new (&dest) T(std::move(value));
         destroy(value);
     }
 
@@ -425,12 +445,12 @@ struct variant_data_policy_big : variant_data_base_policy<T, variant_data_policy
 
     static RTTR_INLINE void destroy(T& value)
     {
-        delete &value;
+        destroy_variant_value(&value);
     }
 
     static RTTR_INLINE void clone(const T& value, variant_data& dest)
     {
-        reinterpret_cast<T*&>(dest) = new T(value);
+        reinterpret_cast<T*&>(dest) = create_variant_value<T>(value);
     }
 
     static RTTR_INLINE void swap(T& value, variant_data& dest)
@@ -441,7 +461,7 @@ struct variant_data_policy_big : variant_data_base_policy<T, variant_data_policy
     template<typename U>
     static RTTR_INLINE void create(U&& value, variant_data& dest)
     {
-        reinterpret_cast<T*&>(dest) = new T(std::forward<U>(value));
+        reinterpret_cast<T*&>(dest) = create_variant_value<T>(std::forward<U>(value));
     }
 };
 
@@ -499,7 +519,7 @@ struct variant_data_policy_array_small : variant_data_base_policy<T, variant_dat
 template<typename T>
 struct variant_data_policy_array_big : variant_data_base_policy<T, variant_data_policy_array_big<T>>
 {
-    using array_dest_type = decltype(new T);
+    using array_dest_type = decay_t<T>;
 
     static RTTR_INLINE const T& get_value(const variant_data& data)
     {
@@ -508,12 +528,12 @@ struct variant_data_policy_array_big : variant_data_base_policy<T, variant_data_
 
     static RTTR_INLINE void destroy(T& value)
     {
-        delete [] &value;
+        destroy_variant_value(reinterpret_cast<variant_array_value<T>*>(&value));
     }
 
     static RTTR_INLINE void clone(const T& value, variant_data& dest)
     {
-        reinterpret_cast<array_dest_type&>(dest) = new T;
+        reinterpret_cast<array_dest_type&>(dest) = create_variant_value<variant_array_value<T>>()->m_array;
 
         COPY_ARRAY_PRE_PROC(value, dest);
     }
@@ -526,8 +546,7 @@ struct variant_data_policy_array_big : variant_data_base_policy<T, variant_data_
     template<typename U>
     static RTTR_INLINE void create(U&& value, variant_data& dest)
     {
-        using array_dest_type = decltype(new T);
-        reinterpret_cast<array_dest_type&>(dest) = new T;
+        reinterpret_cast<array_dest_type&>(dest) = create_variant_value<variant_array_value<T>>()->m_array;
 
         COPY_ARRAY_PRE_PROC(value, dest);
     }
@@ -571,23 +590,28 @@ struct variant_data_policy_arithmetic : variant_data_base_policy<T, variant_data
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+using variant_data_policy_string_base = conditional_t<can_place_in_variant<std::string>::value,
+                                                      variant_data_policy_small<std::string, default_type_converter<std::string>>,
+                                                      variant_data_policy_big<std::string, default_type_converter<std::string>>>;
+
 /*!
  * This policy will manage the type std::string.
  *
  * This type has build in converter for several other basic types, that why we have a specialization here for it.
+ * When it fits into \ref variant_data, it is placed inside the variant, otherwise it is allocated on the heap.
  */
-struct RTTR_API variant_data_policy_string : variant_data_policy_big<std::string, default_type_converter<std::string>>
+struct RTTR_API variant_data_policy_string : variant_data_policy_string_base
 {
     template<typename U>
     static RTTR_INLINE void create(U&& value, variant_data& dest)
     {
-        reinterpret_cast<std::string*&>(dest) = new std::string(std::forward<U>(value));
+        variant_data_policy_string_base::create(std::forward<U>(value), dest);
     }
 
     template<std::size_t N>
     static RTTR_INLINE void create(const char (&value)[N], variant_data& dest)
     {
-        reinterpret_cast<std::string*&>(dest) = new std::string(value, N - 1);
+        variant_data_policy_string_base::create(std::string(value, N - 1), dest);
     }
 };
 
@@ -32,6 +32,7 @@
 #include "rttr/detail/misc/misc_type_traits.h"
 #include "rttr/detail/misc/utility.h"
 #include "rttr/detail/type/type_converter.h"
+#include "rttr/detail/conversion/builtin_conversion.h"
 #include "rttr/detail/misc/data_address_container.h"
 #include "rttr/detail/variant/variant_data_policy.h"
 #include "rttr/variant_array_view.h"
@@ -44,6 +45,9 @@ namespace rttr
 
 RTTR_INLINE variant::variant()
 :   m_policy(&detail::variant_data_policy_empty::invoke)
+#if RTTR_VARIANT_CACHE_TYPE
+,   m_type_data(nullptr)
+#endif
 {
 }
 
@@ -52,6 +56,9 @@ RTTR_INLINE variant::variant()
 template<typename T, typename Tp>
 RTTR_INLINE variant::variant(T&& val)
 :   m_policy(&detail::variant_policy<Tp>::invoke)
+#if RTTR_VARIANT_CACHE_TYPE
+,   m_type_data(type::get<detail::variant_policy_held_type<Tp>>().m_type_data)
+#endif
 {
     static_assert(std::is_copy_constructible<Tp>::value || std::is_array<Tp>::value,
                   "The given value is not copy constructible, try to add a copy constructor to the class.");
@@ -159,9 +166,38 @@ RTTR_INLINE detail::data_address_container variant::get_data_address_container()
 template<typename T>
 RTTR_INLINE bool variant::is_type() const
 {
+    return (type::get<T>() == get_type());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE type variant::get_type() const
+{
+#if RTTR_VARIANT_CACHE_TYPE
+    return (m_type_data ? type(m_type_data) : detail::get_invalid_type());
+#else
     type src_type = detail::get_invalid_type();
     m_policy(detail::variant_policy_operation::GET_TYPE, m_data, src_type);
-    return (type::get<T>() == src_type);
+    return src_type;
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool variant::is_valid() const
+{
+#if RTTR_VARIANT_CACHE_TYPE
+    return (m_type_data != nullptr);
+#else
+    return m_policy(detail::variant_policy_operation::IS_VALID, m_data, detail::argument_wrapper());
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE variant::operator bool() const
+{
+    return is_valid();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -272,8 +308,17 @@ RTTR_INLINE bool variant::convert(T& value) const
     }
     else if (const auto& converter = source_type.get_type_converter(target_type))
     {
-        const auto target_converter = static_cast<const detail::type_converter_target<T>*>(converter);
-        value = target_converter->convert(get_ptr(), ok);
+        if (converter->m_is_chain)
+        {
+            variant var = converter->to_variant(get_ptr(), ok);
+            if (ok)
+                value = var.get_value<T>();
+        }
+        else
+        {
+            const auto target_converter = static_cast<const detail::type_converter_target<T>*>(converter);
+            value = target_converter->convert(get_ptr(), ok);
+        }
     }
     else if (target_type == type::get<std::nullptr_t>())
     {
@@ -353,6 +398,65 @@ RTTR_INLINE T variant::convert(bool* ok) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+namespace detail
+{
+
+template<typename T>
+RTTR_INLINE enable_if_t<builtin_type_of<T>::value != builtin_type::none, std::size_t>
+convert_range_impl(const variant* first, const variant* last, T* out, bool* ok)
+{
+    return convert_variant_range(first, last, builtin_type_of<T>::value, out, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE enable_if_t<builtin_type_of<T>::value == builtin_type::none, std::size_t>
+convert_range_impl(const variant* first, const variant* last, T* out, bool* ok)
+{
+    std::size_t converted = 0;
+    for (; first != last; ++first, ++out)
+    {
+        bool could_convert = false;
+        T value = first->convert<T>(&could_convert);
+        if (could_convert)
+        {
+            *out = std::move(value);
+            ++converted;
+        }
+
+        if (ok)
+            *ok++ = could_convert;
+    }
+
+    return converted;
+}
+
+} // end namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE std::size_t convert_range(const variant* first, const variant* last, T* out, bool* ok)
+{
+    return detail::convert_range_impl(first, last, out, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace rttr
 
+namespace std
+{
+    template <>
+    class hash<rttr::variant>
+    {
+    public:
+        size_t operator()(const rttr::variant& var) const
+        {
+            return var.get_hash();
+        }
+    };
+} // end namespace std
+
 #endif // RTTR_VARIANT_IMPL_H_
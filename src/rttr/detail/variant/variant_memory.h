@@ -0,0 +1,96 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_VARIANT_MEMORY_H_
+#define RTTR_VARIANT_MEMORY_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <type_traits>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * \brief Allocates the memory for a value of a variant, with the current \ref variant_memory_resource.
+ */
+RTTR_API void* allocate_variant_value(std::size_t size, std::size_t alignment);
+
+/*!
+ * \brief Gives the memory \p ptr back to the \ref variant_memory_resource, which allocated it.
+ */
+RTTR_API void deallocate_variant_value(void* ptr, std::size_t size, std::size_t alignment) RTTR_NOEXCEPT;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename... Args>
+static RTTR_INLINE T* create_variant_value(Args&&... args)
+{
+    void* memory = allocate_variant_value(sizeof(T), std::alignment_of<T>::value);
+    try
+    {
+        return new (memory) T(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        deallocate_variant_value(memory, sizeof(T), std::alignment_of<T>::value);
+        throw;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static RTTR_INLINE void destroy_variant_value(T* value) RTTR_NOEXCEPT
+{
+    value->~T();
+    deallocate_variant_value(value, sizeof(T), std::alignment_of<T>::value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * A raw array cannot be constructed and destroyed directly with placement new,
+ * therefore it is wrapped inside this class.
+ */
+template<typename T>
+struct variant_array_value
+{
+    T m_array;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_VARIANT_MEMORY_H_
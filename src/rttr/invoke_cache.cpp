@@ -0,0 +1,168 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/invoke_cache.h"
+
+#include "rttr/detail/type/type_register_p.h"
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+invoke_cache::entry::entry()
+:   m_type(detail::get_invalid_type()),
+    m_method(detail::create_invalid_item<method>()),
+    m_is_used(false)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+invoke_cache::invoke_cache()
+:   m_next_entry(0),
+    m_generation(detail::type_register_private::get_method_generation().load(std::memory_order_acquire))
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant invoke_cache::invoke(const type& t, string_view name, instance obj, argument_range args)
+{
+    if (!t.is_valid())
+        return variant();
+
+    const auto& meth = find(t.get_raw_type(), name, args);
+    if (meth.is_valid())
+        return meth.invoke_variadic(obj, args);
+
+    return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant invoke_cache::invoke(const type& t, string_view name, instance obj, std::vector<argument> args)
+{
+    return invoke(t, name, obj, argument_range(args.data(), args.data() + args.size()));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant invoke_cache::invoke(string_view name, argument_range args)
+{
+    const auto& meth = find(detail::get_invalid_type(), name, args);
+    if (meth.is_valid())
+        return meth.invoke_variadic(instance(), args);
+
+    return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant invoke_cache::invoke(string_view name, std::vector<argument> args)
+{
+    return invoke(name, argument_range(args.data(), args.data() + args.size()));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+method invoke_cache::get_method(const type& t, string_view name, argument_range args)
+{
+    if (!t.is_valid())
+        return detail::create_invalid_item<method>();
+
+    return find(t.get_raw_type(), name, args);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void invoke_cache::clear() RTTR_NOEXCEPT
+{
+    for (auto& item : m_entries)
+        item.m_is_used = false;
+
+    m_next_entry = 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE bool is_same_signature(const std::vector<type>& arg_types, const argument_range& args)
+{
+    if (arg_types.size() != args.size())
+        return false;
+
+    for (std::size_t i = 0; i < args.size(); ++i)
+    {
+        if (arg_types[i] != args[i].get_type())
+            return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const method& invoke_cache::find(const type& raw_type, string_view name, const argument_range& args)
+{
+    // a newly registered method or base class can change the lookup result
+    const std::size_t generation = detail::type_register_private::get_method_generation().load(std::memory_order_acquire);
+    if (m_generation != generation)
+    {
+        clear();
+        m_generation = generation;
+    }
+
+    for (const auto& item : m_entries)
+    {
+        if (item.m_is_used && item.m_type == raw_type && is_same_signature(item.m_arg_types, args) &&
+            string_view(item.m_name) == name)
+        {
+            return item.m_method;
+        }
+    }
+
+    auto& item = m_entries[m_next_entry];
+    m_next_entry = (m_next_entry + 1) % entry_count;
+
+    const auto meth = raw_type.is_valid() ? detail::type_register_private::find_method(raw_type, name, args)
+                                          : detail::type_register_private::find_global_method(name, args);
+
+    item.m_type = raw_type;
+    item.m_name.assign(name.data(), name.size());
+    item.m_arg_types.clear();
+    for (const auto& arg : args)
+        item.m_arg_types.push_back(arg.get_type());
+    item.m_method = (meth ? *meth : detail::create_invalid_item<method>());
+    item.m_is_used = true;
+
+    return item.m_method;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
@@ -0,0 +1,155 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_INVOKE_CACHE_H_
+#define RTTR_INVOKE_CACHE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/argument_range.h"
+#include "rttr/instance.h"
+#include "rttr/method.h"
+#include "rttr/string_view.h"
+#include "rttr/type.h"
+#include "rttr/variant.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace rttr
+{
+
+/*!
+ * The \ref invoke_cache class remembers the result of the method lookup done by invoking a method by name,
+ * i.e. \ref type::invoke(string_view, instance, std::vector<argument>) const "type::invoke()".
+ *
+ * A call site, which invokes methods by name over and over again, holds one \ref invoke_cache object.
+ * For every call, the cache compares the type, the name and the types of the arguments with the ones of its
+ * recent lookups; only when none of them matches, the method will be searched and the result replaces the oldest entry.
+ * So a call site, which sees objects of a few different types (a so called polymorphic call site), is served from the cache as well.
+ *
+ * The cached methods are discarded automatically, as soon as a new method or base class is registered.
+ *
+ * \remark An \ref invoke_cache object is not thread safe; use one object per thread.
+ *
+ * Typical Usage
+ * -------------
+ *
+ * \code{.cpp}
+ *  void script_call(const type& t, instance obj, string_view name, argument_range args)
+ *  {
+ *      static thread_local invoke_cache cache;
+ *      variant result = cache.invoke(t, name, obj, args);
+ *  }
+ * \endcode
+ *
+ * \see type::invoke()
+ */
+class RTTR_API invoke_cache
+{
+    public:
+        //! The number of method lookups, which are remembered by one cache object.
+        static RTTR_CONSTEXPR_OR_CONST std::size_t entry_count = 4;
+
+        /*!
+         * \brief Constructs an empty invoke_cache.
+         */
+        invoke_cache();
+
+        /*!
+         * \brief Invokes the method named \p name of the type \p t on the instance \p obj with the arguments \p args.
+         *
+         * The method will be resolved the same way as in \ref type::invoke(string_view, instance, argument_range) const "type::invoke()";
+         * the lookup is only done, when there is no cached result for the given type, name and argument types.
+         *
+         * \return A variant object containing the possible return value,
+         *         otherwise when it is a void function an empty but valid variant object.
+         */
+        variant invoke(const type& t, string_view name, instance obj, argument_range args);
+
+        /*!
+         * \brief Invokes the method named \p name of the type \p t on the instance \p obj with the arguments \p args.
+         *
+         * \see invoke(const type&, string_view, instance, argument_range)
+         */
+        variant invoke(const type& t, string_view name, instance obj, std::vector<argument> args);
+
+        /*!
+         * \brief Invokes the global method named \p name with the arguments \p args.
+         *
+         * The method will be resolved the same way as in \ref type::invoke(string_view, argument_range) "type::invoke()";
+         * the lookup is only done, when there is no cached result for the given name and argument types.
+         *
+         * \return A variant object containing the possible return value,
+         *         otherwise when it is a void function an empty but valid variant object.
+         */
+        variant invoke(string_view name, argument_range args);
+
+        /*!
+         * \brief Invokes the global method named \p name with the arguments \p args.
+         *
+         * \see invoke(string_view, argument_range)
+         */
+        variant invoke(string_view name, std::vector<argument> args);
+
+        /*!
+         * \brief Returns the method named \p name of the type \p t, which can be invoked with the arguments \p args.
+         *
+         * \return A valid method, when a matching method is registered, otherwise an invalid method.
+         */
+        method get_method(const type& t, string_view name, argument_range args);
+
+        /*!
+         * \brief Removes all cached methods.
+         */
+        void clear() RTTR_NOEXCEPT;
+
+    private:
+        struct entry
+        {
+            entry();
+
+            type                m_type;         // the raw type; an invalid type for global methods
+            std::string         m_name;
+            std::vector<type>   m_arg_types;
+            method              m_method;
+            bool                m_is_used;
+        };
+
+        //! Returns the cached method for the given raw type, name and arguments, or looks it up and caches it.
+        const method& find(const type& raw_type, string_view name, const argument_range& args);
+
+    private:
+        std::array<entry, entry_count>  m_entries;
+        std::size_t                     m_next_entry;
+        std::size_t                     m_generation;
+};
+
+} // end namespace rttr
+
+#endif // RTTR_INVOKE_CACHE_H_
@@ -28,6 +28,7 @@
 #include "rttr/method.h"
 #include "rttr/detail/method/method_wrapper_base.h"
 #include "rttr/argument.h"
+#include "rttr/argument_range.h"
 #include "rttr/instance.h"
 
 using namespace std;
@@ -185,12 +186,26 @@ variant method::invoke(instance object, argument arg1, argument arg2, argument a
 /////////////////////////////////////////////////////////////////////////////////////////
 
 variant method::invoke_variadic(instance object, std::vector<argument> args) const
+{
+    return m_wrapper->invoke_variadic(object, argument_range(args.data(), args.data() + args.size()));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant method::invoke_variadic(instance object, argument_range args) const
 {
     return m_wrapper->invoke_variadic(object, args);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool method::create_handle(const type& signature, void* handle) const
+{
+    return m_wrapper->create_handle(signature, handle);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool method::operator==(const method& other) const RTTR_NOEXCEPT
 {
     return (m_wrapper == other.m_wrapper);
@@ -45,6 +45,10 @@ class variant;
 class type;
 class instance;
 class argument;
+class argument_range;
+
+template<typename Signature>
+class typed_method_handle;
 class method;
 
 namespace detail
@@ -84,6 +88,8 @@ namespace detail
  *
  * While the \ref invoke() function can directly forward up to six arguments, it is sometime necessary to forward even more arguments.
  * Therefore the function \ref invoke_variadic() should be used; it allows to pack an unlimited amount of arguments into a std::vector and forward them to the function.
+ * When the arguments are already stored in a contiguous memory block (e.g. an array on the stack), wrap them into an \ref argument_range;
+ * then they are forwarded without being copied.
  *
  * Another way to invoke a method is to use the \ref type class through \ref type::invoke().
  *
@@ -322,6 +328,46 @@ class RTTR_API method
          */
         variant invoke_variadic(instance object, std::vector<argument> args) const;
 
+        /*!
+         * \brief Invokes the method represented by the current instance \p object, using the arguments of the given range \p args.
+         *
+         * In contrast to the `std::vector` overload, the arguments are not copied; when the arguments are stored
+         * in a stack array, the method will be invoked without allocating any memory.
+         *
+         * \remark The given argument type has to match **exactly** the type of the underling method parameter,
+         *         otherwise the method cannot be invoked and an invalid \ref variant object (see \ref variant::is_valid)
+         *         will be returned.
+         *
+         * \see argument_range
+         *
+         * \return The possible return value of the method.
+         */
+        variant invoke_variadic(instance object, argument_range args) const;
+
+        /*!
+         * \brief Returns a typed handle for calling this method with the call signature \p Signature
+         *        without any reflective overhead.
+         *
+         * The signature is checked only once, when the handle is created; the handle is meant to be retrieved once
+         * and then used many times:
+         *
+         * \code{.cpp}
+         *  auto handle = type::get<calculator>().get_method("add").bind_signature<int(calculator&, int, int)>();
+         *  if (handle)
+         *      int result = handle(obj, 23, 42);
+         * \endcode
+         *
+         * \remark \p Signature has to match **exactly** the registered function, for member functions
+         *         the object is passed as first parameter (see \ref typed_method_handle).
+         *         When it does not match, an invalid handle is returned.
+         *
+         * \see typed_method_handle
+         *
+         * \return A typed handle for this method.
+         */
+        template<typename Signature>
+        RTTR_INLINE typed_method_handle<Signature> bind_signature() const;
+
         /*!
          * \brief Returns true if this method is the same like the \p other.
          *
@@ -339,6 +385,9 @@ class RTTR_API method
     private:
         method(const detail::method_wrapper_base* wrapper) RTTR_NOEXCEPT;
 
+        //! Writes a typed_method_handle<Signature> into \p handle, when \p signature is the type of `Signature*`.
+        bool create_handle(const type& signature, void* handle) const;
+
         template<typename T>
         friend T detail::create_item(const detail::class_item_to_wrapper_t<T>* wrapper);
         template<typename T>
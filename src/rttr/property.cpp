@@ -156,6 +156,32 @@ variant property::get_value(instance object) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant_ref property::get_ref(instance object) const
+{
+    return m_wrapper->get_ref(object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool property::create_accessor(const type& class_type, const type& value_type, void* accessor) const
+{
+    return m_wrapper->create_accessor(class_type, value_type, accessor);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t property::get_offset(bool* ok) const
+{
+    std::size_t offset = 0;
+    const bool has_offset = m_wrapper->get_offset(offset);
+    if (ok)
+        *ok = has_offset;
+
+    return offset;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant property::get_metadata(const variant& key) const
 {
     return m_wrapper->get_metadata(key);
@@ -39,12 +39,16 @@
 namespace rttr
 {
 class variant;
+class variant_ref;
 class type;
 class enumeration;
 class instance;
 class argument;
 class property;
 
+template<typename ClassType, typename ValueType>
+class typed_property_accessor;
+
 namespace detail
 {
     class property_wrapper_base;
@@ -241,6 +245,80 @@ class RTTR_API property
          */
         variant get_value(instance object) const;
 
+        /*!
+         * \brief Returns a non-owning reference to the current property value of the given instance \p object.
+         *
+         * In contrast to \ref get_value(), the property value will not be copied,
+         * which makes this function suitable for read-only traversals of objects, e.g. for serialization.
+         *
+         * \remark Only properties, which are registered as pointer to a member or object, can be referenced.
+         *         For properties registered via getter functions, or when \p object does not match
+         *         the declaring type, an invalid \ref variant_ref is returned.
+         *         When the property is static, you can forward an empty instance.
+         *
+         * \see get_value().
+         *
+         * \return A reference to the property value of the given instance \p object.
+         */
+        variant_ref get_ref(instance object) const;
+
+        /*!
+         * \brief Returns a typed handle for reading and writing the value of this property
+         *        on objects of type \p ClassType without any reflective overhead.
+         *
+         * The handle is meant to be retrieved once and then used many times, e.g. inside a loop:
+         *
+         * \code{.cpp}
+         *  auto accessor = type::get<particle>().get_property("x").get_accessor<particle, float>();
+         *  if (accessor)
+         *      accessor.set(obj, accessor.get(obj) * 2.0f);
+         * \endcode
+         *
+         * \remark \p ClassType has to be the class, which declares the member or the getter function,
+         *         and \p ValueType the type of the property value (without const or reference qualifier).
+         *         When these do not match, or the property is static or registered via free functions,
+         *         an invalid handle is returned.
+         *
+         * \see typed_property_accessor
+         *
+         * \return A typed handle for this property.
+         */
+        template<typename ClassType, typename ValueType>
+        RTTR_INLINE typed_property_accessor<ClassType, ValueType> get_accessor() const;
+
+        /*!
+         * \brief Returns the offset in bytes of the member, which is accessed by this property,
+         *        relative to the begin of an object of the class declaring the member.
+         *
+         * Together with \ref type::get_sizeof() and \ref type::is_trivially_copyable() the value of
+         * this property can be copied from or to many objects directly, e.g. with `std::memcpy`:
+         *
+         * \code{.cpp}
+         *  struct point { float x; float y; };
+         *  property prop = type::get<point>().get_property("y");
+         *  bool ok = false;
+         *  const std::size_t offset = prop.get_offset(&ok);
+         *  if (ok && prop.get_type().is_trivially_copyable())
+         *  {
+         *      for (std::size_t i = 0; i < points.size(); ++i)
+         *          std::memcpy(&column[i], reinterpret_cast<const char*>(&points[i]) + offset, prop.get_type().get_sizeof());
+         *  }
+         * \endcode
+         *
+         * \remark An offset is only available for properties registered as pointer to a member object.
+         *         For all other properties (e.g. getter/setter functions or static properties),
+         *         \p ok is set to false and zero is returned.
+         *         The same applies, when the member is declared in a base class of the \ref get_declaring_type() "declaring type",
+         *         because the base class can be located at any offset inside the declaring type.
+         *         The member at the returned offset has always the type of the registered member;
+         *         the \ref get_type() "type of the property" differs from it, when the property was registered
+         *         with the policy \ref policy::prop::bind_as_ptr "bind_as_ptr" or
+         *         \ref policy::prop::as_reference_wrapper "as_reference_wrapper".
+         *
+         * \return The offset of the member in bytes.
+         */
+        std::size_t get_offset(bool* ok = nullptr) const;
+
         /*!
          * \brief Returns the meta data for the given key \p key.
          *
@@ -269,6 +347,9 @@ class RTTR_API property
         //! Constructs a property from a property_wrapper_base.
         property(const detail::property_wrapper_base* wrapper) RTTR_NOEXCEPT;
 
+        //! Writes a typed_property_accessor<ClassType, ValueType> into \p accessor, when the given types match.
+        bool create_accessor(const type& class_type, const type& value_type, void* accessor) const;
+
         template<typename T>
         friend T detail::create_item(const detail::class_item_to_wrapper_t<T>* wrapper);
         template<typename T>
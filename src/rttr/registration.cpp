@@ -27,6 +27,8 @@
 
 #include "rttr/registration.h"
 
+#include "rttr/detail/type/registry_snapshot.h"
+
 namespace rttr
 {
 
@@ -36,4 +38,11 @@ const detail::protected_access registration::protected_access = {};
 
 const detail::private_access registration::private_access = {};
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void registration::seal()
+{
+    detail::registry_snapshot::seal();
+}
+
 } // end namespace rttr
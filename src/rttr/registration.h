@@ -356,6 +356,22 @@ public:
     template<typename Enum_Type>
     static bind<detail::enum_, void, Enum_Type> enumeration(string_view name);
 
+    /*!
+     * \brief Compacts the properties and methods of all registered classes into one read-only snapshot.
+     *
+     * Call this function once, after all \ref RTTR_REGISTRATION blocks were executed (e.g. at the beginning of `main()`).
+     * Afterwards the member queries of \ref type, like type::get_property() or type::get_methods(),
+     * are answered from the snapshot, which stores the members of all classes in contiguous memory.
+     *
+     * \remark When another property or method is registered afterwards, the snapshot is discarded again;
+     *         the queries stay correct, but use the slower per class data, until \ref seal() is called again.
+     *         Retrieved \ref property or \ref method objects and the ranges returned by type::get_properties()
+     *         or type::get_methods() stay valid; a discarded snapshot is kept alive until the program exits,
+     *         so every call of this function, which is followed by new registrations, keeps one more snapshot in memory.
+     *         This function is not thread safe.
+     */
+    static void seal();
+
     /////////////////////////////////////////////////////////////////////////////////////
 
     /*!
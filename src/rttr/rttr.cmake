@@ -27,6 +27,7 @@
 
 set(HEADER_FILES access_levels.h
                  argument.h
+                 argument_range.h
                  array_mapper.h
                  array_range.h
                  associative_mapper.h
@@ -36,6 +37,7 @@ set(HEADER_FILES access_levels.h
                  enum_flags.h
                  filter_item.h
                  instance.h
+                 invoke_cache.h
                  method.h
                  policy.h
                  property.h
@@ -47,15 +49,20 @@ set(HEADER_FILES access_levels.h
                  rttr_enable.h
                  type
                  type.h
+                 typed_property_accessor.h
+                 typed_method_handle.h
                  variant.h
                  variant_array_view.h
                  variant_associative_view.h
+                 variant_ref.h
+                 variant_memory_resource.h
                  wrapper_mapper.h
                  detail/array/array_accessor.h
                  detail/array/array_accessor_impl.h
                  detail/array/array_mapper_impl.h
                  detail/array/array_wrapper.h
                  detail/array/array_wrapper_base.h
+                 detail/base/config.h.in
                  detail/base/core_prerequisites.h
                  detail/base/version.h.in
                  detail/base/version.rc.in
@@ -73,6 +80,7 @@ set(HEADER_FILES access_levels.h
                  detail/constructor/constructor_wrapper_defaults.h
                  detail/constructor/constructor_wrapper_base.h
                  detail/conversion/std_conversion_functions.h
+                 detail/conversion/builtin_conversion.h
                  detail/conversion/number_conversion.h
                  detail/default_arguments/default_arguments.h
                  detail/default_arguments/invoke_with_defaults.h
@@ -84,12 +92,16 @@ set(HEADER_FILES access_levels.h
                  detail/enumeration/enum_data.h
                  detail/filter/filter_item_funcs.h
                  detail/impl/argument_impl.h
+                 detail/impl/argument_range_impl.h
                  detail/impl/array_range_impl.h
                  detail/impl/associative_mapper_impl.h
                  detail/impl/enum_flags_impl.h
                  detail/impl/instance_impl.h
                  detail/impl/rttr_cast_impl.h
                  detail/impl/string_view_impl.h
+                 detail/impl/typed_property_accessor_impl.h
+                 detail/impl/typed_method_handle_impl.h
+                 detail/impl/variant_ref_impl.h
                  detail/impl/wrapper_mapper_impl.h
                  detail/metadata/metadata.h
                  detail/metadata/metadata_handler.h
@@ -104,6 +116,7 @@ set(HEADER_FILES access_levels.h
                  detail/misc/flat_map.h
                  detail/misc/flat_multimap.h
                  detail/misc/function_traits.h
+                 detail/misc/hash_index.h
 				 detail/misc/iterator_wrapper.h
                  detail/misc/misc_type_traits.h
                  detail/misc/std_type_traits.h
@@ -134,17 +147,20 @@ set(HEADER_FILES access_levels.h
                  detail/type/get_derived_info_func.h
                  detail/type/type_converter.h
                  detail/type/type_comparator.h
+                 detail/type/type_hasher.h
                  detail/type/type_data.h
                  detail/type/type_register.h
                  detail/type/type_impl.h
                  detail/type/type_name.h
                  detail/type/type_register_p.h
+                 detail/type/registry_snapshot.h
                  detail/type/type_string_utils.h
                  detail/variant/variant_compare.h
                  detail/variant/variant_data.h
                  detail/variant/variant_data_converter.h
                  detail/variant/variant_data_policy.h
                  detail/variant/variant_impl.h
+                 detail/variant/variant_memory.h
                  detail/variant_array_view/variant_array_view_impl.h
                  detail/variant_array_view/variant_array_view_creator.h
                  detail/variant_array_view/variant_array_view_creator_impl.h
@@ -157,6 +173,7 @@ set(HEADER_FILES access_levels.h
 set(SOURCE_FILES constructor.cpp
                  destructor.cpp
                  enumeration.cpp
+                 invoke_cache.cpp
                  method.cpp
                  parameter_info.cpp
                  policy.cpp
@@ -166,10 +183,13 @@ set(SOURCE_FILES constructor.cpp
                  variant.cpp
                  variant_array_view.cpp
                  variant_associative_view.cpp
+                 variant_ref.cpp
+                 variant_memory_resource.cpp
                  detail/comparison/compare_equal.cpp
                  detail/comparison/compare_less.cpp
                  detail/misc/standard_types.cpp
                  detail/conversion/std_conversion_functions.cpp
+                 detail/conversion/builtin_conversion.cpp
                  detail/constructor/constructor_wrapper_base.cpp
                  detail/destructor/destructor_wrapper_base.cpp
                  detail/enumeration/enumeration_helper.cpp
@@ -179,5 +199,6 @@ set(SOURCE_FILES constructor.cpp
                  detail/property/property_wrapper_base.cpp
                  detail/registration/registration_executer.cpp
                  detail/type/type_register.cpp
+                 detail/type/registry_snapshot.cpp
                  detail/variant/variant_compare.cpp
                  )
@@ -32,6 +32,7 @@
 #include "rttr/destructor.h"
 #include "rttr/enumeration.h"
 #include "rttr/method.h"
+#include "rttr/argument_range.h"
 
 #include "rttr/detail/constructor/constructor_wrapper_base.h"
 #include "rttr/detail/destructor/destructor_wrapper_base.h"
@@ -43,6 +44,7 @@
 #include "rttr/detail/parameter_info/parameter_infos_compare.h"
 #include "rttr/detail/filter/filter_item_funcs.h"
 #include "rttr/detail/type/type_register_p.h"
+#include "rttr/detail/type/registry_snapshot.h"
 
 #include <algorithm>
 #include <unordered_map>
@@ -54,6 +56,7 @@
 #include <cstring>
 #include <cctype>
 #include <utility>
+#include <limits>
 
 using namespace std;
 
@@ -86,15 +89,9 @@ bool type::is_derived_from(const type& other) const RTTR_NOEXCEPT
     if (src_raw_type == tgt_raw_type)
         return true;
 
-    for (auto& t : src_raw_type->get_class_data().m_base_types)
-    {
-        if (t.m_type_data == tgt_raw_type)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    const auto& base_type_set = src_raw_type->get_class_data().m_base_type_set;
+    const auto index = tgt_raw_type->get_class_data().m_base_type_index;
+    return (index < base_type_set.size() && base_type_set[index]);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -107,15 +104,9 @@ bool type::is_base_of(const type& other) const RTTR_NOEXCEPT
     if (src_raw_type == tgt_raw_type)
         return true;
 
-    for (auto& t : src_raw_type->get_class_data().m_derived_types)
-    {
-        if (t.m_type_data == tgt_raw_type)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    const auto& base_type_set = tgt_raw_type->get_class_data().m_base_type_set;
+    const auto index = src_raw_type->get_class_data().m_base_type_index;
+    return (index < base_type_set.size() && base_type_set[index]);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -133,17 +124,16 @@ void* type::apply_offset(void* ptr, const type& source_type, const type& target_
         return info.m_ptr;
 
     auto& class_list = info.m_type.m_type_data->raw_type_data->get_class_data();
-    int i = 0;
-    for (auto& t : class_list.m_base_types)
-    {
-        if (t.m_type_data == tgt_raw_type)
-        {
-            return class_list.m_conversion_list[i](info.m_ptr);
-        }
-        ++i;
-    }
+    const type* base_type = class_list.m_conversion_index.find(class_list.m_base_types, tgt_raw_type->type_index,
+                                                              [tgt_raw_type](const type& t) { return (t.m_type_data == tgt_raw_type); });
+    if (base_type == nullptr)
+        return nullptr;
 
-    return nullptr;
+    const auto& conversion = class_list.m_conversion_list[base_type - class_list.m_base_types.data()];
+    if (conversion.m_cast_func)
+        return conversion.m_cast_func(info.m_ptr);
+    else
+        return (static_cast<char*>(info.m_ptr) + conversion.m_offset);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -192,12 +182,19 @@ variant type::get_metadata(const variant& key) const
 /////////////////////////////////////////////////////////////////////////////////////////
 
 variant type::create(vector<argument> args) const
+{
+    return create(argument_range(args.data(), args.data() + args.size()));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant type::create(argument_range args) const
 {
     auto& ctors = m_type_data->get_class_data().m_ctors;
     for (const auto& ctor : ctors)
     {
         if (detail::compare_with_arg_list::compare(ctor.get_parameter_infos(), args))
-            return ctor.invoke_variadic(std::move(args));
+            return ctor.invoke_variadic(args);
     }
 
     return variant();
@@ -214,14 +211,15 @@ bool type::destroy(variant& obj) const RTTR_NOEXCEPT
 
 property type::get_property(string_view name) const RTTR_NOEXCEPT
 {
-    const auto& vec = get_raw_type().m_type_data->get_class_data().m_properties;
-    auto ret = std::find_if(vec.cbegin(), vec.cend(),
-                            [name](const property& item)
-                            {
-                                return (item.get_name() == name);
-                            });
-    if (ret != vec.cend())
-        return *ret;
+    const auto raw_t = get_raw_type();
+    if (const auto snapshot = detail::registry_snapshot::get(raw_t))
+        return snapshot->get_property(raw_t, name);
+
+    const auto& class_data = detail::type_register_private::get_class_members(raw_t);
+    auto prop = class_data.m_property_index.find(class_data.m_properties, detail::generate_hash(name.data(), name.length()),
+                                                 [name](const property& item) { return (item.get_name() == name); });
+    if (prop)
+        return *prop;
 
     return detail::create_invalid_item<property>();
 }
@@ -261,7 +259,11 @@ bool type::set_property_value(string_view name, argument arg)
 
 array_range<property> type::get_properties() const RTTR_NOEXCEPT
 {
-    auto& vec = get_raw_type().m_type_data->get_class_data().m_properties;
+    const auto raw_t = get_raw_type();
+    if (const auto snapshot = detail::registry_snapshot::get(raw_t))
+        return snapshot->get_properties(raw_t);
+
+    auto& vec = detail::type_register_private::get_class_members(raw_t).m_properties;
     if (!vec.empty())
     {
         return array_range<property>(vec.data(), vec.size(),
@@ -279,7 +281,10 @@ array_range<property> type::get_properties() const RTTR_NOEXCEPT
 array_range<property> type::get_properties(filter_items filter) const RTTR_NOEXCEPT
 {
     const auto raw_t = get_raw_type();
-    auto& vec = raw_t.m_type_data->get_class_data().m_properties;
+    if (const auto snapshot = detail::registry_snapshot::get(raw_t))
+        return snapshot->get_properties(raw_t, filter);
+
+    auto& vec = detail::type_register_private::get_class_members(raw_t).m_properties;
     if (!vec.empty())
         return array_range<property>(vec.data(), vec.size(), detail::get_filter_predicate<property>(raw_t, filter));
 
@@ -291,14 +296,14 @@ array_range<property> type::get_properties(filter_items filter) const RTTR_NOEXC
 method type::get_method(string_view name) const RTTR_NOEXCEPT
 {
     const auto raw_t = get_raw_type();
-    const auto& vec = raw_t.m_type_data->get_class_data().m_methods;
-    auto ret = std::find_if(vec.cbegin(), vec.cend(),
-                            [name](const method& item)
-                            {
-                                return (item.get_name() == name);
-                            });
-    if (ret != vec.cend())
-        return *ret;
+    if (const auto snapshot = detail::registry_snapshot::get(raw_t))
+        return snapshot->get_method(raw_t, name);
+
+    const auto& class_data = detail::type_register_private::get_class_members(raw_t);
+    auto meth = class_data.m_method_index.find(class_data.m_methods, detail::generate_hash(name.data(), name.length()),
+                                               [name](const method& item) { return (item.get_name() == name); });
+    if (meth)
+        return *meth;
 
     return detail::create_invalid_item<method>();
 }
@@ -308,15 +313,25 @@ method type::get_method(string_view name) const RTTR_NOEXCEPT
 method type::get_method(string_view name, const std::vector<type>& type_list) const RTTR_NOEXCEPT
 {
     const auto raw_t = get_raw_type();
-    for (const auto& meth : raw_t.m_type_data->get_class_data().m_methods)
+    if (const auto snapshot = detail::registry_snapshot::get(raw_t))
     {
-        if ( meth.get_name() == name &&
-             detail::compare_with_type_list::compare(meth.get_parameter_infos(), type_list))
-        {
-            return meth;
-        }
+        if (const auto meth = snapshot->find_method(raw_t, name, type_list))
+            return *meth;
+
+        return detail::create_invalid_item<method>();
     }
 
+    const auto& class_data = detail::type_register_private::get_class_members(raw_t);
+    auto meth = class_data.m_method_signature_index.find(class_data.m_methods,
+                                                         detail::type_register_private::get_signature_hash(name, type_list),
+                                                         [name, &type_list](const method& item)
+                                                         {
+                                                             return (item.get_name() == name &&
+                                                                     detail::compare_with_type_list::compare(item.get_parameter_infos(), type_list));
+                                                         });
+    if (meth)
+        return *meth;
+
     return detail::create_invalid_item<method>();
 }
 
@@ -325,7 +340,10 @@ method type::get_method(string_view name, const std::vector<type>& type_list) co
 array_range<method> type::get_methods() const RTTR_NOEXCEPT
 {
     const auto raw_t = get_raw_type();
-    auto& vec = raw_t.m_type_data->get_class_data().m_methods;
+    if (const auto snapshot = detail::registry_snapshot::get(raw_t))
+        return snapshot->get_methods(raw_t);
+
+    auto& vec = detail::type_register_private::get_class_members(raw_t).m_methods;
     if (!vec.empty())
     {
         return array_range<method>(vec.data(), vec.size(),
@@ -343,7 +361,10 @@ array_range<method> type::get_methods() const RTTR_NOEXCEPT
 array_range<method> type::get_methods(filter_items filter) const RTTR_NOEXCEPT
 {
     const auto raw_t = get_raw_type();
-    auto& vec = raw_t.m_type_data->get_class_data().m_methods;
+    if (const auto snapshot = detail::registry_snapshot::get(raw_t))
+        return snapshot->get_methods(raw_t, filter);
+
+    auto& vec = detail::type_register_private::get_class_members(raw_t).m_methods;
     if (!vec.empty())
         return array_range<method>(vec.data(), vec.size(), detail::get_filter_predicate<method>(raw_t, filter));
 
@@ -422,15 +443,15 @@ enumeration type::get_enumeration() const RTTR_NOEXCEPT
 
 variant type::invoke(string_view name, instance obj, std::vector<argument> args) const
 {
-    const auto raw_t = get_raw_type();
-    for (const auto& meth : raw_t.m_type_data->get_class_data().m_methods)
-    {
-        if ( meth.get_name() == name &&
-             detail::compare_with_arg_list::compare(meth.get_parameter_infos(), args))
-        {
-            return meth.invoke_variadic(obj, args);
-        }
-    }
+    return invoke(name, obj, argument_range(args.data(), args.data() + args.size()));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant type::invoke(string_view name, instance obj, argument_range args) const
+{
+    if (const auto meth = detail::type_register_private::find_method(get_raw_type(), name, args))
+        return meth->invoke_variadic(obj, args);
 
     return variant();
 }
@@ -439,21 +460,15 @@ variant type::invoke(string_view name, instance obj, std::vector<argument> args)
 
 variant type::invoke(string_view name, std::vector<argument> args)
 {
-    auto& meth_list = detail::type_register_private::get_global_method_storage();
-    auto itr = meth_list.find(name);
-    while (itr != meth_list.end())
-    {
-        const auto& meth = *itr;
-        if (meth.get_name() != name)
-            break;
+    return invoke(name, argument_range(args.data(), args.data() + args.size()));
+}
 
-        if (detail::compare_with_arg_list::compare(meth.get_parameter_infos(), args))
-        {
-            return meth.invoke_variadic(instance(), args);
-        }
+/////////////////////////////////////////////////////////////////////////////////////////
 
-        ++itr;
-    }
+variant type::invoke(string_view name, argument_range args)
+{
+    if (const auto meth = detail::type_register_private::find_global_method(name, args))
+        return meth->invoke_variadic(instance(), args);
 
     return variant();
 }
@@ -462,12 +477,25 @@ variant type::invoke(string_view name, std::vector<argument> args)
 
 type type::get_by_name(string_view name) RTTR_NOEXCEPT
 {
-    auto& custom_name_to_id = detail::type_register_private::get_custom_name_to_id();
-    auto ret = custom_name_to_id.find(name);
-    if (ret != custom_name_to_id.end())
-        return (*ret);
+    return detail::type_register_private::get_type_by_name(name);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type type::get_by_name_hash(uint64_t hash_value) RTTR_NOEXCEPT
+{
+    // a hash value, which does not fit into 'std::size_t', was never generated on this platform
+    if (hash_value > std::numeric_limits<std::size_t>::max())
+        return detail::get_invalid_type();
+
+    return detail::type_register_private::get_type_by_name_hash(static_cast<std::size_t>(hash_value));
+}
 
-    return detail::get_invalid_type();
+/////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t type::get_name_hash(string_view name) RTTR_NOEXCEPT
+{
+    return static_cast<uint64_t>(detail::generate_hash(name.data(), name.length()));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
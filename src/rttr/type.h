@@ -51,6 +51,7 @@ class enumeration;
 class type;
 class instance;
 class argument;
+class argument_range;
 
 template<typename Target_Type, typename Source_Type>
 Target_Type rttr_cast(Source_Type object) RTTR_NOEXCEPT;
@@ -164,7 +165,7 @@ type_data& get_type_data() RTTR_NOEXCEPT;
 class RTTR_API type
 {
     public:
-        typedef uint16_t type_id;
+        typedef uint32_t type_id;
 
         /*!
          * \brief Assigns a type to another one.
@@ -321,6 +322,28 @@ class RTTR_API type
          */
         static type get_by_name(string_view name) RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns the type object, whose name has the hash value \p hash_value.
+         *
+         * This is useful, when the hash of a type name is computed once with \ref get_name_hash() and stored,
+         * e.g. in a serialized stream; then the type can be retrieved without hashing and comparing the name again.
+         *
+         * \remark When several type names have the same hash value, an invalid type will be returned,
+         *         because the hash value alone cannot identify the type. Use \ref get_by_name() to retrieve such types.
+         *
+         * \return \ref type object with the given name hash, or an invalid type, when no such type is registered.
+         */
+        static type get_by_name_hash(uint64_t hash_value) RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the hash value of the type name \p name, which can be used with \ref get_by_name_hash().
+         *
+         * \remark The hash value is not guaranteed to be the same between different versions of RTTR.
+         *
+         * \return The hash value of the given name.
+         */
+        static uint64_t get_name_hash(string_view name) RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns a range of all registered type objects.
          *
@@ -440,6 +463,17 @@ class RTTR_API type
          */
         RTTR_FORCE_INLINE bool is_member_function_pointer() const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns true whether the given type is trivially copyable;
+         *        i.e. objects of this type can be copied with `std::memcpy`, e.g. `int`, `float[4]`
+         *        or a `struct` containing only such members.
+         *
+         * \see get_sizeof()
+         *
+         * \return True if the type is trivially copyable, otherwise false.
+         */
+        RTTR_FORCE_INLINE bool is_trivially_copyable() const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns true if this type is derived from the given type \p other, otherwise false.
          *
@@ -607,6 +641,17 @@ class RTTR_API type
          */
         variant create(std::vector<argument> args = std::vector<argument>()) const;
 
+        /*!
+         * \brief Creates an instance of the current type, with the arguments of the given range \p args for the constructor.
+         *
+         * In contrast to the `std::vector` overload, the arguments are not copied.
+         *
+         * \see argument_range
+         *
+         * \return Returns an instance of the given type.
+         */
+        variant create(argument_range args) const;
+
         /*!
          * \brief Returns the corresponding destructor for this type.
          *
@@ -888,6 +933,21 @@ class RTTR_API type
          */
         variant invoke(string_view name, instance obj, std::vector<argument> args) const;
 
+        /*!
+         * \brief Invokes the method named \p name represented by the current instance \p obj,
+         *        with the arguments of the given range \p args.
+         *
+         * In contrast to the `std::vector` overload, the arguments are not copied; when the arguments are stored
+         * in a stack array, the method will be looked up and invoked without allocating any memory.
+         * To avoid the method lookup for repeated calls, use an \ref invoke_cache.
+         *
+         * \see argument_range, invoke_cache
+         *
+         * \return A variant object containing the possible return value,
+         *         otherwise when it is a void function an empty but valid variant object.
+         */
+        variant invoke(string_view name, instance obj, argument_range args) const;
+
         /*!
          * \brief Invokes a global method named \p name with the specified argument \p args.
          *
@@ -897,6 +957,16 @@ class RTTR_API type
          */
         static variant invoke(string_view name, std::vector<argument> args);
 
+        /*!
+         * \brief Invokes a global method named \p name with the arguments of the given range \p args.
+         *
+         * \see argument_range
+         *
+         * \return A variant object containing the possible return value,
+         *         otherwise when it is a void function an empty but valid variant object.
+         */
+        static variant invoke(string_view name, argument_range args);
+
         /*!
          * \brief Register a converter func `F`, which will be used internally by the
          *        \ref variant class to convert between types.
@@ -916,6 +986,10 @@ class RTTR_API type
          *   type::register_converter_func(conv_func);
          *  \endcode
          *
+         * \remark Registered converters are combined automatically:
+         *         when a converter `A -> B` and a converter `B -> C` is registered, a variant containing `A` can be converted to `C`.
+         *         The path with the fewest conversions is used, it is searched only once for every pair of source and target type.
+         *
          * \see variant::convert()
          */
         template<typename F>
@@ -1003,6 +1077,35 @@ class RTTR_API type
         template<typename T>
         static void register_less_than_comparator();
 
+        /*!
+         * \brief Register a hash function for template type \p T.
+         *        This requires a valid specialization of `std::hash<T>`.
+         *
+         * The registered hash function will be used by \ref variant::get_hash(),
+         * so that variants containing \p T can be used as key in hashed containers, like `std::unordered_map`.
+         * Arithmetic types, `std::string`, \ref string_view and enumerations are hashed without registration.
+         *
+         * See following example code:
+         *  \code{.cpp}
+         *   variant a = my_id(23);
+         *   variant b = my_id(23);
+         *
+         *   a.get_hash() == b.get_hash();   // yields to false
+         *
+         *   // register hash function for type 'my_id'
+         *   type::register_hasher<my_id>();
+         *
+         *   a.get_hash() == b.get_hash();   // yields to true
+         *  \endcode
+         *
+         * \remark To be used consistently with \ref variant::operator==(), an equal comparator
+         *         has to be registered as well; see \ref register_equal_comparator().
+         *
+         * \see variant::get_hash()
+         */
+        template<typename T>
+        static void register_hasher();
+
     private:
 
         /*!
@@ -1081,6 +1184,7 @@ class RTTR_API type
         RTTR_FORCE_INLINE variant create_variant(const argument& data) const;
 
         friend class variant;
+        friend class variant_ref;
         template<typename Target_Type, typename Source_Type>
         friend Target_Type rttr_cast(Source_Type object) RTTR_NOEXCEPT;
 
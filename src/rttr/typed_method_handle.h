@@ -0,0 +1,134 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_TYPED_METHOD_HANDLE_H_
+#define RTTR_TYPED_METHOD_HANDLE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+#include "rttr/method.h"
+
+#include <utility>
+
+namespace rttr
+{
+
+template<typename Signature>
+class typed_method_handle;
+
+/*!
+ * The \ref typed_method_handle class is a small, typed handle for calling a \ref method without any reflective overhead.
+ * A handle is retrieved once via \ref method::bind_signature<Signature>() "method::bind_signature<Signature>()",
+ * which checks the given call signature against the registered function;
+ * afterwards \ref invoke() calls the function directly, i.e. without creating an \ref instance,
+ * an \ref argument or a \ref variant and without any type check. The return value is not wrapped inside a \ref variant,
+ * it is returned as it is.
+ *
+ * The call signature is `ReturnType(ParameterTypes...)` and has to match **exactly** the registered function;
+ * i.e. the parameter types including their const and reference qualifiers.
+ * For member functions the object is the first parameter: `ReturnType(ClassType&, ParameterTypes...)`,
+ * where `ClassType` is the class, which declares the member function. A `const` member function
+ * can also be bound with `ReturnType(const ClassType&, ParameterTypes...)`.
+ *
+ * \remark Registered \ref default_arguments and \ref policy::meth "policies" are not considered;
+ *         every parameter has to be provided.
+ *
+ * Typical Usage
+ * -------------
+ *
+ * \code{.cpp}
+ *  struct calculator { int add(int a, int b) { return a + b; } };
+ *  //...
+ *  auto handle = type::get<calculator>().get_method("add").bind_signature<int(calculator&, int, int)>();
+ *  if (handle)
+ *  {
+ *      calculator obj;
+ *      int result = handle(obj, 23, 42);
+ *  }
+ * \endcode
+ *
+ * \remark The handle is only valid as long as the library, which registered the method, is loaded.
+ *
+ * \see method::bind_signature()
+ */
+template<typename ReturnType, typename... Args>
+class typed_method_handle<ReturnType(Args...)>
+{
+    public:
+        using invoke_func = ReturnType (*)(const void* func, Args... args);
+
+        /*!
+         * \brief Constructs an invalid typed_method_handle.
+         */
+        RTTR_INLINE typed_method_handle() RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Constructs a typed_method_handle, which calls \p invoker with \p func and the given arguments.
+         *
+         * \remark Use \ref method::bind_signature() to retrieve a handle for a registered method.
+         */
+        RTTR_INLINE typed_method_handle(const void* func, invoke_func invoker) RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true when this handle can call a function, otherwise false.
+         */
+        RTTR_INLINE bool is_valid() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Convenience function to check if this handle is valid or not.
+         *
+         * \see is_valid()
+         */
+        RTTR_INLINE explicit operator bool() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Calls the bound function with the given arguments \p args.
+         *
+         * \remark Only call this function on a \ref is_valid() "valid" handle, otherwise undefined behaviour will occur.
+         *
+         * \return The return value of the bound function.
+         */
+        RTTR_INLINE ReturnType invoke(Args... args) const;
+
+        /*!
+         * \brief Calls the bound function with the given arguments \p args.
+         *
+         * \see invoke()
+         */
+        RTTR_INLINE ReturnType operator()(Args... args) const;
+
+    private:
+        const void* m_func;
+        invoke_func m_invoke;
+};
+
+} // end namespace rttr
+
+#include "rttr/detail/impl/typed_method_handle_impl.h"
+
+#endif // RTTR_TYPED_METHOD_HANDLE_H_
@@ -0,0 +1,154 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_TYPED_PROPERTY_ACCESSOR_H_
+#define RTTR_TYPED_PROPERTY_ACCESSOR_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/std_type_traits.h"
+#include "rttr/type.h"
+#include "rttr/property.h"
+
+#include <type_traits>
+
+namespace rttr
+{
+
+/*!
+ * The \ref typed_property_accessor class is a small, typed handle for reading and writing
+ * the value of a \ref property without any reflective overhead.
+ *
+ * A handle is retrieved once via \ref property::get_accessor<C, T>() "property::get_accessor<ClassType, ValueType>()";
+ * afterwards \ref get() and \ref set() access the value directly, i.e. without creating an \ref instance,
+ * an \ref argument or a \ref variant and without any type check.
+ *
+ * The handle holds one of the following:
+ *  - the pointer to member of a property registered as member object (regardless of the used \ref policy::prop "policy")
+ *  - the getter and setter of a property registered as member functions
+ *
+ * Static properties and properties registered via free getter/setter functions are not supported;
+ * for these an invalid handle is returned.
+ *
+ * Typical Usage
+ * -------------
+ *
+ * \code{.cpp}
+ *  struct particle { float x; };
+ *  //...
+ *  auto accessor = type::get<particle>().get_property("x").get_accessor<particle, float>();
+ *  if (accessor)
+ *  {
+ *      for (auto& p : particles)
+ *          accessor.set(p, accessor.get(p) + 1.0f);
+ *  }
+ * \endcode
+ *
+ * \remark The handle is only valid as long as the library, which registered the property, is loaded.
+ *
+ * \see property::get_accessor()
+ */
+template<typename ClassType, typename ValueType>
+class typed_property_accessor
+{
+    static_assert(!std::is_const<ClassType>::value && !std::is_reference<ClassType>::value,
+                  "The class type of a typed_property_accessor cannot be const or a reference.");
+    static_assert(!std::is_const<ValueType>::value && !std::is_reference<ValueType>::value && !std::is_array<ValueType>::value,
+                  "The value type of a typed_property_accessor cannot be const, a reference or an array.");
+
+    public:
+        using member_ptr  = ValueType ClassType::*;
+        using getter_func = ValueType (*)(const void* getter, const ClassType& object);
+        using setter_func = void (*)(const void* setter, ClassType& object, const ValueType& value);
+
+        /*!
+         * \brief Constructs an invalid typed_property_accessor.
+         */
+        RTTR_INLINE typed_property_accessor() RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Constructs a typed_property_accessor for the pointer to member \p member.
+         *
+         * \remark Use \ref property::get_accessor() to retrieve a handle for a registered property.
+         */
+        RTTR_INLINE typed_property_accessor(member_ptr member, bool is_readonly) RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Constructs a typed_property_accessor, which calls \p get_func with \p getter for reading
+         *        and \p set_func with \p setter for writing the value.
+         *        When \p set_func is a `nullptr`, the handle is read only.
+         *
+         * \remark Use \ref property::get_accessor() to retrieve a handle for a registered property.
+         */
+        RTTR_INLINE typed_property_accessor(const void* getter, getter_func get_func,
+                                            const void* setter, setter_func set_func) RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true when this handle can access a property value, otherwise false.
+         */
+        RTTR_INLINE bool is_valid() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Convenience function to check if this handle is valid or not.
+         *
+         * \see is_valid()
+         */
+        RTTR_INLINE explicit operator bool() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true when the property value cannot be written with this handle, otherwise false.
+         */
+        RTTR_INLINE bool is_readonly() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the property value of the given \p object.
+         *
+         * \remark Only call this function on a \ref is_valid() "valid" handle, otherwise undefined behaviour will occur.
+         */
+        RTTR_INLINE ValueType get(const ClassType& object) const;
+
+        /*!
+         * \brief Sets the property value of the given \p object to \p value.
+         *
+         * \return True, when the value could be set; false, when the handle is invalid or \ref is_readonly() "read only".
+         */
+        RTTR_INLINE bool set(ClassType& object, const ValueType& value) const;
+
+    private:
+        member_ptr  m_member;
+        const void* m_getter;
+        const void* m_setter;
+        getter_func m_get_func;
+        setter_func m_set_func;
+        bool        m_is_readonly;
+};
+
+} // end namespace rttr
+
+#include "rttr/detail/impl/typed_property_accessor_impl.h"
+
+#endif // RTTR_TYPED_PROPERTY_ACCESSOR_H_
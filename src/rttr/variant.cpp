@@ -30,9 +30,11 @@
 #include "rttr/detail/variant/variant_data_policy.h"
 #include "rttr/variant_array_view.h"
 #include "rttr/variant_associative_view.h"
+#include "rttr/variant_ref.h"
 #include "rttr/argument.h"
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <string>
 #include <set>
@@ -44,6 +46,9 @@ namespace rttr
 
 variant::variant(const variant& other)
 :   m_policy(other.m_policy)
+#if RTTR_VARIANT_CACHE_TYPE
+,   m_type_data(other.m_type_data)
+#endif
 {
     m_policy(detail::variant_policy_operation::CLONE, other.m_data, m_data);
 }
@@ -52,9 +57,15 @@ variant::variant(const variant& other)
 
 variant::variant(variant&& other)
 :   m_policy(other.m_policy)
+#if RTTR_VARIANT_CACHE_TYPE
+,   m_type_data(other.m_type_data)
+#endif
 {
     other.m_policy(detail::variant_policy_operation::SWAP, other.m_data, m_data);
     other.m_policy = &detail::variant_data_policy_empty::invoke;
+#if RTTR_VARIANT_CACHE_TYPE
+    other.m_type_data = nullptr;
+#endif
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -81,6 +92,9 @@ void variant::swap(variant& other)
 
         tmp_policy_func(detail::variant_policy_operation::SWAP, tmp_data, m_data);
         m_policy = tmp_policy_func;
+#if RTTR_VARIANT_CACHE_TYPE
+        std::swap(m_type_data, other.m_type_data);
+#endif
     }
     else
     {
@@ -91,6 +105,9 @@ void variant::swap(variant& other)
         full_policy_func(detail::variant_policy_operation::SWAP, full_data, empty_data);
 
         std::swap(m_policy, other.m_policy);
+#if RTTR_VARIANT_CACHE_TYPE
+        std::swap(m_type_data, other.m_type_data);
+#endif
     }
 }
 
@@ -104,6 +121,9 @@ variant& variant::operator=(const variant& other)
     m_policy(detail::variant_policy_operation::DESTROY, m_data, detail::argument_wrapper());
     other.m_policy(detail::variant_policy_operation::CLONE, other.m_data, m_data);
     m_policy = other.m_policy;
+#if RTTR_VARIANT_CACHE_TYPE
+    m_type_data = other.m_type_data;
+#endif
 
     return *this;
 }
@@ -116,6 +136,10 @@ variant& variant::operator=(variant&& other)
     other.m_policy(detail::variant_policy_operation::SWAP, other.m_data, m_data);
     m_policy = other.m_policy;
     other.m_policy = &detail::variant_data_policy_empty::invoke;
+#if RTTR_VARIANT_CACHE_TYPE
+    m_type_data = other.m_type_data;
+    other.m_type_data = nullptr;
+#endif
 
     return *this;
 }
@@ -136,24 +160,67 @@ bool variant::compare_less(const variant& other) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-void variant::clear()
+bool variant::compare_builtin(const type& lhs_type, const variant& other, const type& rhs_type,
+                              bool less_than, bool& result) const
 {
-    m_policy(detail::variant_policy_operation::DESTROY, m_data, detail::argument_wrapper());
-    m_policy = &detail::variant_data_policy_empty::invoke;
+    using detail::builtin_type;
+    const builtin_type lhs_kind = lhs_type.m_type_data->m_builtin_type;
+    const builtin_type rhs_kind = rhs_type.m_type_data->m_builtin_type;
+
+    if (lhs_kind == builtin_type::none || rhs_kind == builtin_type::none)
+    {
+        const builtin_type lhs_enum_kind = lhs_type.m_type_data->m_underlying_builtin_type;
+        const builtin_type rhs_enum_kind = rhs_type.m_type_data->m_underlying_builtin_type;
+
+        if (!less_than)
+        {
+            // an enumeration is equal to an integral value, when its underlying value is equal
+            return detail::compare_enum_with_integral_equal(lhs_kind, lhs_enum_kind, get_ptr(),
+                                                            rhs_kind, rhs_enum_kind, other.get_ptr(), result);
+        }
+        else if (lhs_enum_kind != builtin_type::none &&
+                 detail::is_integral_builtin_type(rhs_kind) && rhs_kind != builtin_type::boolean)
+        {
+            // the enumeration is converted to the integral type of the right hand side, like 'variant_compare_less' does;
+            // the storage is written and read only as this type
+            std::aligned_storage<sizeof(uint64_t), std::alignment_of<uint64_t>::value>::type lhs_value;
+            if (!detail::get_builtin_conversion(lhs_enum_kind, rhs_kind)(get_ptr(), &lhs_value))
+                return false;
+
+            result = detail::get_builtin_less_compare(rhs_kind, rhs_kind)(&lhs_value, other.get_ptr());
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    const auto compare_func = less_than ? detail::get_builtin_less_compare(lhs_kind, rhs_kind)
+                                        : detail::get_builtin_equal_compare(lhs_kind, rhs_kind);
+    if (!compare_func)
+        return false;
+
+    result = compare_func(get_ptr(), other.get_ptr());
+    return true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-bool variant::is_valid() const
+std::size_t variant::get_hash() const
 {
-    return m_policy(detail::variant_policy_operation::IS_VALID, m_data, detail::argument_wrapper());
+    return variant_ref(*this).get_hash();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-variant::operator bool() const
+void variant::clear()
 {
-    return m_policy(detail::variant_policy_operation::IS_VALID, m_data, detail::argument_wrapper());
+    m_policy(detail::variant_policy_operation::DESTROY, m_data, detail::argument_wrapper());
+    m_policy = &detail::variant_data_policy_empty::invoke;
+#if RTTR_VARIANT_CACHE_TYPE
+    m_type_data = nullptr;
+#endif
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -172,15 +239,6 @@ bool variant::is_associative_container() const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-type variant::get_type() const
-{
-    type src_type = detail::get_invalid_type();
-    m_policy(detail::variant_policy_operation::GET_TYPE, m_data, src_type);
-    return src_type;
-}
-
-/////////////////////////////////////////////////////////////////////////////////////////
-
 variant variant::extract_wrapped_value() const
 {
     variant var;
@@ -219,6 +277,9 @@ bool variant::can_convert(const type& target_type) const
     if (source_type == target_type)
         return true;
 
+    if (detail::get_builtin_conversion(source_type.m_type_data->m_builtin_type, target_type.m_type_data->m_builtin_type))
+        return true;
+
     if (source_type.get_pointer_dimension() == 1 && target_type.get_pointer_dimension() == 1)
     {
         if (void * ptr = type::apply_offset(get_raw_ptr(), source_type, target_type))
@@ -246,6 +307,19 @@ bool variant::can_convert(const type& target_type) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename T>
+bool variant::convert_to_builtin_type(const variant& source, variant& target)
+{
+    T value;
+    if (!source.try_basic_type_conversion(value))
+        return false;
+
+    target = std::move(value);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool variant::convert(const type& target_type, variant& target_var) const
 {
     if (!is_valid())
@@ -255,7 +329,7 @@ bool variant::convert(const type& target_type, variant& target_var) const
 
     const type source_type = get_type();
     const bool source_is_arithmetic = source_type.is_arithmetic();
-    const bool target_is_arithmetic = target_type.is_arithmetic();
+    const detail::builtin_type target_kind = target_type.m_type_data->m_builtin_type;
     const type string_type = type::get<std::string>();
     if (target_type == source_type)
     {
@@ -268,90 +342,30 @@ bool variant::convert(const type& target_type, variant& target_var) const
         ok = var.convert(target_type);
         target_var = var;
     }
-    else if ((source_is_arithmetic && target_is_arithmetic) ||
-            (source_is_arithmetic && target_type == string_type) ||
-            (source_type == string_type && target_is_arithmetic) ||
-            (source_type.is_enumeration() && target_is_arithmetic) ||
-            (source_type.is_enumeration() && target_type == string_type))
+    else if (target_kind != detail::builtin_type::none &&
+             (source_is_arithmetic || source_type == string_type || source_type.is_enumeration()))
     {
-        if (target_type == type::get<bool>())
-        {
-            bool value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<char>())
-        {
-            char value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<int8_t>())
-        {
-            int8_t value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<int16_t>())
-        {
-            int16_t value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<int32_t>())
-        {
-            int32_t value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<int64_t>())
-        {
-            int64_t value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<uint8_t>())
-        {
-            uint8_t value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<uint16_t>())
-        {
-            uint16_t value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<uint32_t>())
-        {
-            uint32_t value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<uint64_t>())
-        {
-            uint64_t value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<float>())
-        {
-            float value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<double>())
+        using convert_func = bool (*)(const variant&, variant&);
+        // indexed by 'detail::builtin_type', the order has to match its declaration order
+        static const convert_func builtin_type_conversions[] =
         {
-            double value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == string_type)
-        {
-            std::string value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = std::move(value);
-        }
+            nullptr,
+            &convert_to_builtin_type<bool>,
+            &convert_to_builtin_type<char>,
+            &convert_to_builtin_type<int8_t>,
+            &convert_to_builtin_type<int16_t>,
+            &convert_to_builtin_type<int32_t>,
+            &convert_to_builtin_type<int64_t>,
+            &convert_to_builtin_type<uint8_t>,
+            &convert_to_builtin_type<uint16_t>,
+            &convert_to_builtin_type<uint32_t>,
+            &convert_to_builtin_type<uint64_t>,
+            &convert_to_builtin_type<float>,
+            &convert_to_builtin_type<double>,
+            &convert_to_builtin_type<std::string>
+        };
+
+        ok = builtin_type_conversions[static_cast<std::size_t>(target_kind)](*this, target_var);
     }
     else if ((source_is_arithmetic || source_type == string_type)
              && target_type.is_enumeration())
@@ -393,6 +407,174 @@ bool variant::convert(const type& target_type, variant& target_var) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+
+/*!
+ * Yields `true`, when every value of type \p From can be represented exactly as \p To,
+ * i.e. a simple `static_cast` gives the same result like `convert_from<From>::to()`.
+ */
+template<typename From, typename To>
+using is_lossless_arithmetic_conversion = std::integral_constant<bool,
+    std::is_same<From, To>::value ||
+    (!std::is_same<To, bool>::value &&
+     (std::is_same<From, bool>::value ||
+      (std::is_integral<From>::value && std::is_integral<To>::value &&
+       (std::numeric_limits<To>::is_signed || !std::numeric_limits<From>::is_signed) &&
+       std::numeric_limits<To>::digits >= std::numeric_limits<From>::digits) ||
+      (std::is_floating_point<To>::value &&
+       std::numeric_limits<To>::digits >= std::numeric_limits<From>::digits)))>;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Converts \p count arithmetic values of consecutive variants; \p data points to the value of the first variant.
+ * Arithmetic values are always placed inside the variant, so the values are `sizeof(variant)` bytes apart.
+ */
+template<typename From, typename To>
+static enable_if_t<is_lossless_arithmetic_conversion<From, To>::value, std::size_t>
+convert_arithmetic_run(const char* data, std::size_t count, To* out, bool* ok)
+{
+    for (std::size_t i = 0; i < count; ++i)
+        out[i] = static_cast<To>(*reinterpret_cast<const From*>(data + i * sizeof(variant)));
+
+    if (ok)
+        std::fill(ok, ok + count, true);
+
+    return count;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename From, typename To>
+static enable_if_t<!is_lossless_arithmetic_conversion<From, To>::value, std::size_t>
+convert_arithmetic_run(const char* data, std::size_t count, To* out, bool* ok)
+{
+    std::size_t converted = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const bool could_convert = convert_from<From>::to(*reinterpret_cast<const From*>(data + i * sizeof(variant)), out[i]);
+        converted += could_convert;
+        if (ok)
+            ok[i] = could_convert;
+    }
+
+    return converted;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+using arithmetic_run_func = std::size_t (*)(const char* data, std::size_t count, T* out, bool* ok);
+
+template<typename T>
+static enable_if_t<std::is_arithmetic<T>::value, arithmetic_run_func<T>>
+get_arithmetic_run_func(builtin_type source_kind)
+{
+    // indexed by 'detail::builtin_type', the order has to match its declaration order
+    static const arithmetic_run_func<T> run_funcs[] =
+    {
+        nullptr,
+        &convert_arithmetic_run<bool, T>,
+        &convert_arithmetic_run<char, T>,
+        &convert_arithmetic_run<int8_t, T>,
+        &convert_arithmetic_run<int16_t, T>,
+        &convert_arithmetic_run<int32_t, T>,
+        &convert_arithmetic_run<int64_t, T>,
+        &convert_arithmetic_run<uint8_t, T>,
+        &convert_arithmetic_run<uint16_t, T>,
+        &convert_arithmetic_run<uint32_t, T>,
+        &convert_arithmetic_run<uint64_t, T>,
+        &convert_arithmetic_run<float, T>,
+        &convert_arithmetic_run<double, T>,
+        nullptr
+    };
+
+    return run_funcs[static_cast<std::size_t>(source_kind)];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static enable_if_t<!std::is_arithmetic<T>::value, arithmetic_run_func<T>>
+get_arithmetic_run_func(builtin_type source_kind)
+{
+    return nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t convert_variant_range(const variant* first, const variant* last, builtin_type target_kind, void* out, bool* ok)
+{
+    using range_func = std::size_t (*)(const variant*, const variant*, void*, bool*);
+    // indexed by 'detail::builtin_type', the order has to match its declaration order
+    static const range_func range_funcs[] =
+    {
+        nullptr,
+        &variant::convert_range_to<bool>,
+        &variant::convert_range_to<char>,
+        &variant::convert_range_to<int8_t>,
+        &variant::convert_range_to<int16_t>,
+        &variant::convert_range_to<int32_t>,
+        &variant::convert_range_to<int64_t>,
+        &variant::convert_range_to<uint8_t>,
+        &variant::convert_range_to<uint16_t>,
+        &variant::convert_range_to<uint32_t>,
+        &variant::convert_range_to<uint64_t>,
+        &variant::convert_range_to<float>,
+        &variant::convert_range_to<double>,
+        &variant::convert_range_to<std::string>
+    };
+
+    return range_funcs[static_cast<std::size_t>(target_kind)](first, last, out, ok);
+}
+
+} // end namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+std::size_t variant::convert_range_to(const variant* first, const variant* last, void* out_ptr, bool* ok)
+{
+    T* out = static_cast<T*>(out_ptr);
+    std::size_t converted = 0;
+    while (first != last)
+    {
+        // consecutive variants with the same policy hold the same type, they are converted together
+        const variant* run_last = first + 1;
+        while (run_last != last && run_last->m_policy == first->m_policy)
+            ++run_last;
+
+        const std::size_t count = static_cast<std::size_t>(run_last - first);
+        const auto source_kind = first->get_type().m_type_data->m_builtin_type;
+        if (const auto run = detail::get_arithmetic_run_func<T>(source_kind))
+        {
+            converted += run(static_cast<const char*>(first->get_ptr()), count, out, ok);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const bool could_convert = first[i].convert<T>(out[i]);
+                converted += could_convert;
+                if (ok)
+                    ok[i] = could_convert;
+            }
+        }
+
+        first = run_last;
+        out += count;
+        if (ok)
+            ok += count;
+    }
+
+    return converted;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool variant::convert(const type& target_type)
 {
     return convert(target_type, *this);
@@ -33,6 +33,7 @@
 #include "rttr/detail/variant/variant_data.h"
 #include "rttr/detail/misc/argument_wrapper.h"
 #include "rttr/detail/variant/variant_compare.h"
+#include "rttr/detail/conversion/builtin_conversion.h"
 
 #include <type_traits>
 #include <cstddef>
@@ -52,12 +53,14 @@ class instance;
 namespace detail
 {
     struct data_address_container;
+    struct type_data;
     template<typename T>
     struct empty_type_converter;
 
     template<typename T, typename Tp, typename Converter = empty_type_converter<T>>
     struct variant_data_base_policy;
     struct variant_data_policy_nullptr_t;
+    struct type_converter_chain;
 
     enum class variant_policy_operation : uint8_t;
 
@@ -66,6 +69,9 @@ namespace detail
                                         !std::is_same<Decayed, variant_array_view>::value, Decayed>;
 
     using variant_policy_func = bool (*)(variant_policy_operation, const variant_data&, argument_wrapper);
+
+    RTTR_API std::size_t convert_variant_range(const variant* first, const variant* last,
+                                               builtin_type target_kind, void* out, bool* ok);
 }
 
 /*!
@@ -289,6 +295,29 @@ class RTTR_API variant
          */
         RTTR_INLINE bool operator<(const variant& other) const;
 
+        /*!
+         * \brief Returns a hash value for the content of this variant.
+         *
+         * Variants that compare equal with \ref variant::operator==(const variant&) const "operator==" have the same hash value,
+         * when they contain the same type, when both contain an integral type (including `bool` and enumerations),
+         * or when a floating point value is exactly equal to the integral value it is compared with.
+         * That makes it possible to use a variant as key in hashed containers, like `std::unordered_map<variant, T>`.
+         *
+         * \remark A floating point value is compared with a value of another arithmetic type as *almost equal*,
+         *         i.e. with a relative tolerance; e.g. `variant(1) == variant(1.0000000000001)` returns `true`.
+         *         Such variants do **not** have the same hash value, because a tolerance cannot be expressed by a hash.
+         *         So when floating point keys are mixed with keys of other arithmetic types in one hashed container,
+         *         convert them to a common type first.
+         *
+         * All arithmetic types (also `long long`, `wchar_t` or `long double`), `std::string`, \ref string_view,
+         * enumerations and pointers are hashed by their value out of the box.
+         * For every other type, a hash function has to be registered with \ref type::register_hasher<T>(),
+         * otherwise only the \ref get_type() "type" of the contained value is hashed.
+         *
+         * \return The hash value of the contained value; an invalid variant returns `0`.
+         */
+        std::size_t get_hash() const;
+
         /*!
          * \brief When the variant contains a value, then this function will clear the content.
          *
@@ -316,7 +345,7 @@ class RTTR_API variant
          *
          * \return \ref type of the underlying data type.
          */
-        type get_type() const;
+        RTTR_INLINE type get_type() const;
 
         /*!
          * \brief Returns true if this variant is valid, that means the variant is holding some data.
@@ -329,7 +358,7 @@ class RTTR_API variant
          *
          * \return `True` if this variant is valid, otherwise `false`.
          */
-        bool is_valid() const;
+        RTTR_INLINE bool is_valid() const;
 
         /*!
          * \brief Convenience function to check if this \ref variant is valid or not.
@@ -338,7 +367,7 @@ class RTTR_API variant
          *
          * \return `True` if this \ref variant is valid, otherwise `false`.
          */
-        explicit operator bool() const;
+        RTTR_INLINE explicit operator bool() const;
 
         /*!
          * \brief When the \ref variant::get_type "type" or its \ref type::get_raw_type() "raw type"
@@ -906,6 +935,22 @@ class RTTR_API variant
         template<typename T>
         bool try_basic_type_conversion(T& to) const;
 
+        /*!
+         * \brief Converts the value of \p source to the built-in type \p T and stores it in \p target.
+         *
+         * \return `True`, when the conversion was successful, otherwise `false`.
+         */
+        template<typename T>
+        static bool convert_to_builtin_type(const variant& source, variant& target);
+
+        /*!
+         * \brief Converts the variants in the range [\p first, \p last) to the built-in type \p T.
+         *
+         * \see rttr::convert_range()
+         */
+        template<typename T>
+        static std::size_t convert_range_to(const variant* first, const variant* last, void* out, bool* ok);
+
         /*!
          * \brief Tries to convert the internal pointer type to the given pointer type \p T.
          *
@@ -938,6 +983,16 @@ class RTTR_API variant
          */
         bool compare_less(const variant& other) const;
 
+        /*!
+         * \brief Compares the containing value of type \p lhs_type with the value of the variant \p other of the different type \p rhs_type
+         *        through the comparison table of the built-in types, when both contain a built-in type or an enumeration.
+         *
+         * \return `true`, when \p result contains the result of the comparison;
+         *         `false`, when the comparison needs a conversion to one of both types.
+         */
+        bool compare_builtin(const type& lhs_type, const variant& other, const type& rhs_type,
+                             bool less_than, bool& result) const;
+
         /*!
          * \brief A function to check whether the contained pointer type is a `nullptr` or not.
          *
@@ -948,18 +1003,54 @@ class RTTR_API variant
     private:
         friend class argument;
         friend class instance;
+        friend class variant_ref;
 
         template<typename T, typename Tp, typename Converter>
         friend struct detail::variant_data_base_policy;
         friend struct detail::variant_data_policy_nullptr_t;
+        friend struct detail::type_converter_chain;
         friend RTTR_API bool detail::variant_compare_less(const variant&, const type&, const variant&, const type&);
+        friend RTTR_API std::size_t detail::convert_variant_range(const variant*, const variant*,
+                                                                 detail::builtin_type, void*, bool*);
 
         detail::variant_data            m_data;
         detail::variant_policy_func     m_policy;
+#if RTTR_VARIANT_CACHE_TYPE
+        //! the type of the contained value, so type queries do not need to call 'm_policy'; a `nullptr` when this variant is empty
+        detail::type_data*              m_type_data;
+#endif
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+/*!
+ * \brief Converts all variants in the range [\p first, \p last) to the type \p T
+ *        and writes the results to the contiguous buffer \p out, which has to hold `last - first` elements.
+ *
+ * Converting a range is much faster than calling \ref variant::convert() "convert<T>()" for every element;
+ * consecutive variants which hold the same type are converted together, for arithmetic types in a tight loop
+ * without any type dispatch per element.
+ *
+ * When \p ok is non-null, it has to point to a buffer with `last - first` elements;
+ * `ok[i]` is set to `true` when the i-th variant could be converted, otherwise to `false`.
+ * The value in \p out of an element which could not be converted is unspecified.
+ *
+ * See following example code:
+ * \code{.cpp}
+ *  std::vector<variant> values = { 1, 2.5f, std::string("3.5"), 4u };
+ *  std::vector<double> numbers(values.size());
+ *
+ *  std::size_t count = convert_range(values.data(), values.data() + values.size(), numbers.data());
+ *  // count == 4, numbers == { 1.0, 2.5, 3.5, 4.0 }
+ * \endcode
+ *
+ * \return The number of successfully converted elements.
+ */
+template<typename T>
+std::size_t convert_range(const variant* first, const variant* last, T* out, bool* ok = nullptr);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace rttr
 
 #include "rttr/detail/variant/variant_impl.h"
@@ -31,6 +31,7 @@
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/misc/misc_type_traits.h"
 #include "rttr/variant.h"
+#include "rttr/variant_ref.h"
 
 #include <cstddef>
 #include <vector>
@@ -391,6 +392,27 @@ class RTTR_API variant_array_view
          */
         variant get_value_as_ref(std::size_t index_1) const;
 
+        /*!
+         * \brief Returns a non-owning reference to the value of the array in the first dimension at index \p index_1.
+         *
+         * In contrast to \ref get_value(), the value will not be copied.
+         *
+         * \code{.cpp}
+         *  std::vector<std::string> vec(10, "text");
+         *  variant var = std::ref(vec);
+         *
+         *  variant_ref value = var.create_array_view().get_ref(5);
+         *  value.get_type() == type::get<std::string>(); // yields to true
+         *  const std::string& text = value.get_value<std::string>();
+         * \endcode
+         *
+         * \remark When the array does not return its values by reference (e.g. `std::vector<bool>`),
+         *         or \p index_1 is out of range, an invalid \ref variant_ref is returned.
+         *
+         * \return A reference to the value of the given array at the specified index.
+         */
+        variant_ref get_ref(std::size_t index_1) const;
+
 
         /*!
          * \brief Inserts the given argument \p arg into the array, in the first dimension at index \p index_1.
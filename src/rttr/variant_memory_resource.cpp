@@ -0,0 +1,145 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/variant_memory_resource.h"
+#include "rttr/detail/variant/variant_memory.h"
+
+#include <atomic>
+#include <new>
+#include <type_traits>
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+struct new_delete_resource : variant_memory_resource
+{
+    void* allocate(std::size_t size, std::size_t)
+    {
+        // the alignment of the basic types is sufficient, over aligned types are not placed into a variant
+        return ::operator new(size);
+    }
+
+    void deallocate(void* ptr, std::size_t, std::size_t) RTTR_NOEXCEPT
+    {
+        ::operator delete(ptr);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::atomic<variant_memory_resource*>& get_current_resource()
+{
+    static std::atomic<variant_memory_resource*> resource(variant_memory_resource::get_default_resource());
+    return resource;
+}
+
+} // end anonymous namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_memory_resource::~variant_memory_resource()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_memory_resource* variant_memory_resource::get_default_resource() RTTR_NOEXCEPT
+{
+    // the resource is never destroyed, because variants with static storage duration
+    // (e.g. the metadata of registered types) give their values back to it after the end of main()
+    static std::aligned_storage<sizeof(new_delete_resource), std::alignment_of<new_delete_resource>::value>::type storage;
+    static variant_memory_resource* const resource = new (&storage) new_delete_resource;
+    return resource;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_memory_resource* variant_memory_resource::get_memory_resource() RTTR_NOEXCEPT
+{
+    return get_current_resource().load(std::memory_order_acquire);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_memory_resource* variant_memory_resource::set_memory_resource(variant_memory_resource* resource) RTTR_NOEXCEPT
+{
+    if (!resource)
+        resource = get_default_resource();
+
+    return get_current_resource().exchange(resource, std::memory_order_acq_rel);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// the resource is stored in front of the value, padded to keep the alignment of the value
+static RTTR_INLINE std::size_t get_header_size(std::size_t alignment)
+{
+    return (alignment > sizeof(variant_memory_resource*) ? alignment : sizeof(variant_memory_resource*));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void* allocate_variant_value(std::size_t size, std::size_t alignment)
+{
+    const auto header_size = get_header_size(alignment);
+    auto resource = variant_memory_resource::get_memory_resource();
+    // the default resource is called directly, without the virtual call
+    auto memory = static_cast<char*>((resource == variant_memory_resource::get_default_resource())
+                                     ? ::operator new(header_size + size)
+                                     : resource->allocate(header_size + size, header_size));
+    *reinterpret_cast<variant_memory_resource**>(memory) = resource;
+
+    return (memory + header_size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void deallocate_variant_value(void* ptr, std::size_t size, std::size_t alignment) RTTR_NOEXCEPT
+{
+    const auto header_size = get_header_size(alignment);
+    auto memory = static_cast<char*>(ptr) - header_size;
+    auto resource = *reinterpret_cast<variant_memory_resource**>(memory);
+    if (resource == variant_memory_resource::get_default_resource())
+        ::operator delete(memory);
+    else
+        resource->deallocate(memory, header_size + size, header_size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
@@ -0,0 +1,113 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_VARIANT_MEMORY_RESOURCE_H_
+#define RTTR_VARIANT_MEMORY_RESOURCE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstddef>
+
+namespace rttr
+{
+
+/*!
+ * The \ref variant_memory_resource class is the interface for the memory,
+ * which is used for the values of a \ref variant, that do not fit into its inline storage.
+ *
+ * By default, the memory is allocated with the global `operator new`.
+ * A custom resource, e.g. a pool with different size classes or a thread local arena,
+ * can be installed with \ref set_memory_resource().
+ *
+ * Typical Usage
+ * ----------------------
+ *
+ * \code{.cpp}
+ *  struct my_pool_resource : variant_memory_resource
+ *  {
+ *      void* allocate(std::size_t size, std::size_t alignment) { return my_pool.allocate(size, alignment); }
+ *      void deallocate(void* ptr, std::size_t size, std::size_t alignment) RTTR_NOEXCEPT { my_pool.deallocate(ptr, size); }
+ *  };
+ *
+ *  static my_pool_resource pool_resource;
+ *  variant_memory_resource::set_memory_resource(&pool_resource);
+ * \endcode
+ *
+ * \remark Every allocated value remembers the resource it was allocated with, and is given back to this resource;
+ *         even when another resource was installed meanwhile. So a custom resource has to outlive every variant,
+ *         which holds a value allocated through it. This includes variants with static storage duration,
+ *         e.g. the metadata of registered types, which are destroyed after the end of `main()`;
+ *         when in doubt, do not destroy the resource at all.
+ *         A value can be deallocated from another thread, than the one which allocated it.
+ *
+ * \remark The \ref get_default_resource() "default resource" is never destroyed.
+ */
+class RTTR_API variant_memory_resource
+{
+    public:
+        virtual ~variant_memory_resource();
+
+        /*!
+         * \brief Allocates at least \p size bytes of memory, aligned to \p alignment.
+         *
+         * \remark When no memory could be allocated, an exception has to be thrown, e.g. `std::bad_alloc`.
+         *
+         * \return A pointer to the allocated memory.
+         */
+        virtual void* allocate(std::size_t size, std::size_t alignment) = 0;
+
+        /*!
+         * \brief Deallocates the memory \p ptr, which was allocated with \ref allocate() with the same \p size and \p alignment.
+         */
+        virtual void deallocate(void* ptr, std::size_t size, std::size_t alignment) RTTR_NOEXCEPT = 0;
+
+        /*!
+         * \brief Returns the resource, which allocates the memory with the global `operator new`.
+         *
+         * \return The default memory resource.
+         */
+        static variant_memory_resource* get_default_resource() RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the resource, which is currently used to allocate the values of a \ref variant.
+         *
+         * \return The current memory resource.
+         */
+        static variant_memory_resource* get_memory_resource() RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Sets the resource, which will be used to allocate the values of a \ref variant from now on.
+         *        When \p resource is a `nullptr`, the \ref get_default_resource() "default resource" will be used.
+         *
+         * \return The previous memory resource.
+         */
+        static variant_memory_resource* set_memory_resource(variant_memory_resource* resource) RTTR_NOEXCEPT;
+};
+
+} // end namespace rttr
+
+#endif // RTTR_VARIANT_MEMORY_RESOURCE_H_
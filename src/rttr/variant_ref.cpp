@@ -0,0 +1,195 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/variant_ref.h"
+
+#include "rttr/detail/type/type_register_p.h"
+#include "rttr/detail/type/type_hasher.h"
+#include "rttr/detail/comparison/compare_equal.h"
+#include "rttr/detail/variant/variant_compare.h"
+
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <string>
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE std::size_t hash_integral_value(uint64_t value)
+{
+    return std::hash<uint64_t>()(value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static RTTR_INLINE detail::enable_if_t<std::is_integral<T>::value, std::size_t>
+hash_arithmetic_value(T value)
+{
+    return hash_integral_value(static_cast<uint64_t>(value));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static RTTR_INLINE detail::enable_if_t<std::is_floating_point<T>::value, std::size_t>
+hash_arithmetic_value(T value)
+{
+    // floating point values with an integral value compare equal to integers, so they have to hash equal too
+    const double d = static_cast<double>(value);
+    if (std::isnan(d))
+        return 0;
+
+    if (d == std::trunc(d) && d >= -9223372036854775808.0 && d < 9223372036854775808.0)
+        return hash_integral_value(static_cast<uint64_t>(static_cast<int64_t>(d)));
+
+    return std::hash<double>()(d);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static std::size_t hash_builtin_value(const void* value)
+{
+    // the value might be of another type with the same representation, e.g. 'long long' for 'int64_t'
+    T data;
+    std::memcpy(&data, value, sizeof(T));
+    return hash_arithmetic_value(data);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<>
+std::size_t hash_builtin_value<std::string>(const void* value)
+{
+    const auto& text = *static_cast<const std::string*>(value);
+    return detail::generate_hash(text.data(), text.size());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t variant_ref::get_hash() const
+{
+    using hash_func = std::size_t (*)(const void*);
+    using detail::builtin_type;
+    // indexed by 'builtin_type', in the order of its enumerators
+    static const hash_func builtin_hash_funcs[static_cast<std::size_t>(builtin_type::BUILTIN_TYPE_COUNT)] =
+    {
+        nullptr,
+        &hash_builtin_value<bool>,
+        &hash_builtin_value<char>,
+        &hash_builtin_value<int8_t>,
+        &hash_builtin_value<int16_t>,
+        &hash_builtin_value<int32_t>,
+        &hash_builtin_value<int64_t>,
+        &hash_builtin_value<uint8_t>,
+        &hash_builtin_value<uint16_t>,
+        &hash_builtin_value<uint32_t>,
+        &hash_builtin_value<uint64_t>,
+        &hash_builtin_value<float>,
+        &hash_builtin_value<double>,
+        &hash_builtin_value<std::string>
+    };
+
+    if (!is_valid())
+        return 0;
+
+    const type t = get_type();
+
+    // enumerations and integral types without an own built-in type are hashed like the integer with the same
+    // representation, because they compare equal to it
+    if (const auto func = builtin_hash_funcs[static_cast<std::size_t>(m_type_data->m_value_builtin_type)])
+        return func(m_ptr);
+
+    if (t == type::get<string_view>())
+    {
+        const auto& text = *static_cast<const string_view*>(m_ptr);
+        return detail::generate_hash(text.data(), text.size());
+    }
+
+    if (t == type::get<long double>())
+        return hash_arithmetic_value(*static_cast<const long double*>(m_ptr));
+
+    if (auto hasher = detail::type_register_private::get_hasher(t))
+        return hasher->hash(m_ptr);
+
+    if (t.is_pointer())
+        return std::hash<const void*>()(*static_cast<const void* const*>(m_ptr));
+
+    return std::hash<type>()(t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_ref::operator==(const variant_ref& other) const
+{
+    using detail::builtin_type;
+
+    if (!is_valid() || !other.is_valid())
+        return (is_valid() == other.is_valid());
+
+    const builtin_type lhs_kind = m_type_data->m_builtin_type;
+    const builtin_type rhs_kind = other.m_type_data->m_builtin_type;
+    if (lhs_kind != builtin_type::none && rhs_kind != builtin_type::none)
+    {
+        if (const auto compare_func = detail::get_builtin_equal_compare(lhs_kind, rhs_kind))
+            return compare_func(m_ptr, other.m_ptr);
+    }
+
+    const builtin_type lhs_enum_kind = m_type_data->m_underlying_builtin_type;
+    const builtin_type rhs_enum_kind = other.m_type_data->m_underlying_builtin_type;
+    if (lhs_enum_kind != builtin_type::none && m_type_data == other.m_type_data)
+        return detail::get_builtin_equal_compare(lhs_enum_kind, lhs_enum_kind)(m_ptr, other.m_ptr);
+
+    if (lhs_enum_kind != builtin_type::none || rhs_enum_kind != builtin_type::none)
+    {
+        // an enumeration is equal to an integral value, when its underlying value is equal
+        bool result = false;
+        detail::compare_enum_with_integral_equal(lhs_kind, lhs_enum_kind, m_ptr, rhs_kind, rhs_enum_kind, other.m_ptr, result);
+        return result;
+    }
+
+    if (m_type_data != other.m_type_data)
+        return false;
+
+    if (m_ptr == other.m_ptr)
+        return true;
+
+    const type t = get_type();
+    if (t.is_pointer())
+        return (*static_cast<const void* const*>(m_ptr) == *static_cast<const void* const*>(other.m_ptr));
+
+    return detail::compare_types_equal(m_ptr, other.m_ptr, t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
@@ -0,0 +1,181 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_VARIANT_REF_H_
+#define RTTR_VARIANT_REF_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/misc_type_traits.h"
+
+#include <type_traits>
+#include <cstddef>
+
+namespace rttr
+{
+
+class type;
+class variant;
+
+namespace detail
+{
+struct type_data;
+}
+
+/*!
+ * The \ref variant_ref class is a non-owning, read-only reference to a value of any \ref type "type".
+ *
+ * It consists only of the address of the referenced value and its \ref get_type() "type";
+ * creating or copying a \ref variant_ref will never copy the referenced value or allocate memory.
+ * This makes it suitable for generic read-only traversals, e.g. serialization, hashing or diffing of objects,
+ * where the values are visited, but never stored.
+ *
+ * The referenced value has to outlive the \ref variant_ref object, otherwise undefined behaviour will occur.
+ *
+ * Typical Usage
+ * -------------
+ *
+ * \code{.cpp}
+ *  struct point { int x = 1; int y = 2; };
+ *  point obj;
+ *
+ *  for (auto& prop : type::get(obj).get_properties())
+ *  {
+ *      variant_ref value = prop.get_ref(obj);  // no copy of the property value
+ *      if (value.is_type<int>())
+ *          std::cout << value.get_value<int>();
+ *  }
+ * \endcode
+ *
+ * \see property::get_ref(), variant_array_view::get_ref()
+ */
+class RTTR_API variant_ref
+{
+    template<typename T>
+    using decay_ref_t = detail::enable_if_t<!std::is_same<T, variant>::value &&
+                                            !std::is_same<T, variant_ref>::value, T>;
+
+    public:
+        /*!
+         * \brief Constructs an invalid variant_ref, which does not reference any value.
+         */
+        RTTR_INLINE variant_ref() RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Constructs a variant_ref, which references the given \p value.
+         */
+        template<typename T, typename Tp = decay_ref_t<T>>
+        RTTR_INLINE explicit variant_ref(const T& value) RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Constructs a variant_ref, which references the value contained in the given variant \p var.
+         *
+         * \remark The reference is only valid as long as \p var is not modified or destroyed.
+         */
+        RTTR_INLINE explicit variant_ref(const variant& var) RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true when this variant_ref references a value, otherwise false.
+         */
+        RTTR_INLINE bool is_valid() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Convenience function to check if this variant_ref references a value.
+         *
+         * \see is_valid()
+         */
+        RTTR_INLINE explicit operator bool() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the \ref type "type" of the referenced value.
+         *
+         * \remark When the variant_ref is not valid, an invalid type is returned.
+         */
+        RTTR_INLINE type get_type() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true if the referenced value is of the given template type \p T, otherwise false.
+         */
+        template<typename T>
+        RTTR_INLINE bool is_type() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns a reference to the referenced value.
+         *
+         * \remark Only call this function when \ref is_type<T>() returns true, otherwise undefined behaviour will occur.
+         */
+        template<typename T>
+        RTTR_INLINE const T& get_value() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the address of the referenced value.
+         */
+        RTTR_INLINE const void* get_ptr() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns a hash value for the referenced value.
+         *
+         * The returned value is the same as \ref variant::get_hash() would return for a variant,
+         * which contains a copy of the referenced value.
+         *
+         * \return The hash value of the referenced value; an invalid variant_ref returns zero.
+         */
+        std::size_t get_hash() const;
+
+        /*!
+         * \brief Compares the referenced value with the one referenced by \p other.
+         *
+         * Values of the same built-in type (arithmetic types and `std::string`) or arithmetic values
+         * of different types are compared directly; enumerations are compared by their underlying value.
+         * Any other values of the same type are compared with the comparator registered via
+         * \ref type::register_equal_comparator().
+         *
+         * \remark Two invalid variant_ref objects are equal.
+         *
+         * \return True when both referenced values are equal, otherwise false.
+         */
+        bool operator==(const variant_ref& other) const;
+
+        /*!
+         * \brief Compares the referenced value with the one referenced by \p other.
+         *
+         * \see operator==
+         *
+         * \return True when both referenced values are not equal, otherwise false.
+         */
+        RTTR_INLINE bool operator!=(const variant_ref& other) const;
+
+    private:
+        const void*         m_ptr;
+        detail::type_data*  m_type_data;
+};
+
+} // end namespace rttr
+
+#include "rttr/detail/impl/variant_ref_impl.h"
+
+#endif // RTTR_VARIANT_REF_H_
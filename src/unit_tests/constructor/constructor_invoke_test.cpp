@@ -310,6 +310,37 @@ TEST_CASE("constructor - invoke variadic", "[constructor]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("constructor - invoke variadic - argument_range", "[constructor]")
+{
+    type t = type::get<ctor_invoke_test>();
+
+    constructor ctor = t.get_constructor({type::get<int>(), type::get<int>(), type::get<int>(),
+                                          type::get<int>(), type::get<int>(), type::get<int>(),
+                                          type::get<const int* const>()
+                                         });
+    REQUIRE(ctor.is_valid() == true);
+
+    int a = 1, b = 2, c = 3, d = 4, e = 5, f = 6;
+    const int value = 23;
+    const int* ptr = &value;
+    argument args[] = {a, b, c, d, e, f, ptr};
+
+    variant var = ctor.invoke_variadic(argument_range(args, args + 6));
+    CHECK(var.is_valid() == false);
+
+    var = ctor.invoke_variadic(argument_range(args, args + 7));
+    REQUIRE(var.is_valid() == true);
+    CHECK(var.get_value<ctor_invoke_test*>()->value_1 == 1);
+    CHECK(t.get_destructor().invoke(var) == true);
+
+    var = t.create(argument_range(args, args + 7));
+    REQUIRE(var.is_valid() == true);
+    CHECK(var.get_value<ctor_invoke_test*>()->value_2 == 2);
+    CHECK(t.get_destructor().invoke(var) == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("constructor - invoke ctor valid", "[constructor]")
 {
     auto range = type::get<ctor_invoke_arg_test>().get_constructors();
@@ -0,0 +1,205 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+#include <rttr/type>
+
+#include <string>
+
+#include <catch/catch.hpp>
+
+using namespace rttr;
+
+struct invoke_cache_base
+{
+    virtual ~invoke_cache_base() {}
+    int get_id() const { return 1; }
+
+    RTTR_ENABLE()
+};
+
+struct invoke_cache_derived : invoke_cache_base
+{
+    int get_derived_id() const { return 2; }
+
+    RTTR_ENABLE(invoke_cache_base)
+};
+
+struct invoke_cache_other
+{
+    int get_id() const { return 3; }
+};
+
+struct invoke_cache_late
+{
+    int late_func() const { return 4; }
+};
+
+static int invoke_cache_global_func(int value) { return value * 2; }
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<invoke_cache_base>("invoke_cache_base")
+        .method("get_id", &invoke_cache_base::get_id)
+        .method("func_overloaded", [](int) { return 1; })
+        .method("func_overloaded", [](double) { return 2; })
+        .method("func_overloaded", [](int, int) { return 3; })
+        .method("func_overloaded", [](int, double) { return 4; })
+        .method("func_default", [](int value, int factor) { return value * factor; })
+        (
+            default_arguments(10)
+        )
+        ;
+
+    registration::class_<invoke_cache_derived>("invoke_cache_derived")
+        .method("get_derived_id", &invoke_cache_derived::get_derived_id)
+        ;
+
+    registration::class_<invoke_cache_other>("invoke_cache_other")
+        .method("get_id", &invoke_cache_other::get_id)
+        ;
+
+    registration::class_<invoke_cache_late>("invoke_cache_late");
+
+    registration::method("invoke_cache_global_func", &invoke_cache_global_func);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("invoke_cache - invoke", "[invoke_cache]")
+{
+    invoke_cache cache;
+    type t = type::get<invoke_cache_base>();
+
+    for (int i = 0; i < 3; ++i)
+    {
+        CHECK(cache.invoke(t, "func_overloaded", instance(), {42}).get_value<int>() == 1);
+        CHECK(cache.invoke(t, "func_overloaded", instance(), {42.0}).get_value<int>() == 2);
+        CHECK(cache.invoke(t, "func_overloaded", instance(), {42, 23}).get_value<int>() == 3);
+        CHECK(cache.invoke(t, "func_overloaded", instance(), {42, 23.0}).get_value<int>() == 4);
+        CHECK(cache.invoke(t, "func_overloaded", instance(), {42.0, 23}).is_valid() == false);
+        CHECK(cache.invoke(t, "func_overloaded", instance(), {true}).is_valid() == false);
+    }
+
+    CHECK(cache.invoke(t, "func_default", instance(), {4}).get_value<int>() == 40);
+    CHECK(cache.invoke(t, "func_default", instance(), {4, 2}).get_value<int>() == 8);
+
+    int value = 5;
+    argument args[] = {value};
+    CHECK(cache.invoke(t, "func_default", instance(), argument_range(args, args + 1)).get_value<int>() == 50);
+    CHECK(cache.invoke(t, "func_default", instance(), argument_range(args, args + 1)).get_value<int>() == 50);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("invoke_cache - polymorphic call site", "[invoke_cache]")
+{
+    invoke_cache cache;
+
+    invoke_cache_base base;
+    invoke_cache_derived derived;
+    invoke_cache_other other;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        CHECK(cache.invoke(type::get(base), "get_id", base, {}).get_value<int>() == 1);
+        CHECK(cache.invoke(type::get(derived), "get_id", derived, {}).get_value<int>() == 1);
+        CHECK(cache.invoke(type::get(derived), "get_derived_id", derived, {}).get_value<int>() == 2);
+        CHECK(cache.invoke(type::get(other), "get_id", other, {}).get_value<int>() == 3);
+        CHECK(cache.invoke(type::get(base), "get_derived_id", base, {}).is_valid() == false);
+        CHECK(cache.invoke(type::get(other), "get_derived_id", other, {}).is_valid() == false);
+    }
+
+    // the raw type is used for the lookup
+    invoke_cache_base* base_ptr = &derived;
+    CHECK(cache.invoke(type::get(base_ptr), "get_id", base_ptr, {}).get_value<int>() == 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("invoke_cache - global method", "[invoke_cache]")
+{
+    invoke_cache cache;
+
+    CHECK(cache.invoke("invoke_cache_global_func", {21}).get_value<int>() == 42);
+    CHECK(cache.invoke("invoke_cache_global_func", {21}).get_value<int>() == 42);
+    CHECK(cache.invoke("invoke_cache_global_func", {21.0}).is_valid() == false);
+
+    // the global method is not a member of any class
+    CHECK(cache.invoke(type::get<invoke_cache_base>(), "invoke_cache_global_func", instance(), {21}).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("invoke_cache - get_method", "[invoke_cache]")
+{
+    invoke_cache cache;
+    type t = type::get<invoke_cache_base>();
+
+    int i = 1;
+    double d = 2.0;
+    argument args[] = {i, d};
+    method meth = cache.get_method(t, "func_overloaded", argument_range(args, args + 2));
+    CHECK(meth.is_valid() == true);
+    CHECK(meth == t.get_method("func_overloaded", {type::get<int>(), type::get<double>()}));
+
+    CHECK(cache.get_method(t, "unknown", argument_range(args, args + 2)).is_valid() == false);
+    CHECK(cache.get_method(type::get_by_name(""), "func_overloaded", argument_range(args, args + 2)).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("invoke_cache - registration invalidates the cache", "[invoke_cache]")
+{
+    invoke_cache cache;
+    type t = type::get<invoke_cache_late>();
+    invoke_cache_late obj;
+
+    CHECK(cache.invoke(t, "late_func", obj, {}).is_valid() == false);
+
+    registration::class_<invoke_cache_late>("invoke_cache_late")
+        .method("late_func", &invoke_cache_late::late_func);
+
+    CHECK(cache.invoke(t, "late_func", obj, {}).get_value<int>() == 4);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("invoke_cache - clear", "[invoke_cache]")
+{
+    invoke_cache cache;
+    type t = type::get<invoke_cache_base>();
+
+    CHECK(cache.invoke(t, "func_overloaded", instance(), {42}).get_value<int>() == 1);
+    cache.clear();
+    CHECK(cache.invoke(t, "func_overloaded", instance(), {42}).get_value<int>() == 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -64,6 +64,10 @@ RTTR_REGISTRATION
         .method("func_7", &method_invoke_test::func_7)
         .method("func_8", std::function<int(int)>([](int value){ return value; }))
         .method("func_9", [](int value){ return value; })
+        .method("func_overloaded", [](int) { return 1; })
+        .method("func_overloaded", [](double) { return 2; })
+        .method("func_overloaded", [](int, int) { return 3; })
+        .method("func_overloaded", [](int, double) { return 4; })
         ;
 }
 
@@ -192,3 +196,75 @@ TEST_CASE("method - invoke - lambda", "[method]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - invoke - overloaded", "[method]")
+{
+    type t = type::get<method_invoke_test>();
+
+    CHECK(t.invoke("func_overloaded", instance(), {42}).get_value<int>() == 1);
+    CHECK(t.invoke("func_overloaded", instance(), {42.0}).get_value<int>() == 2);
+    CHECK(t.invoke("func_overloaded", instance(), {42, 23}).get_value<int>() == 3);
+    CHECK(t.invoke("func_overloaded", instance(), {42, 23.0}).get_value<int>() == 4);
+
+    CHECK(t.invoke("func_overloaded", instance(), {true}).is_valid() == false);
+    CHECK(t.invoke("func_overloaded", instance(), {42.0, 23}).is_valid() == false);
+
+    method meth = t.get_method("func_overloaded", {type::get<int>(), type::get<double>()});
+    REQUIRE(meth.is_valid() == true);
+    CHECK(meth.invoke(instance(), 42, 23.0).get_value<int>() == 4);
+
+    CHECK(t.get_method("func_overloaded", {type::get<double>(), type::get<double>()}).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - invoke - argument_range", "[method]")
+{
+    type t = type::get<method_invoke_test>();
+    method meth = t.get_method("func_7");
+    REQUIRE(meth.is_valid() == true);
+
+    int a = 1, b = 2, c = 3, d = 4, e = 5, f = 6, g = 7;
+    argument args[] = {a, b, c, d, e, f, g};
+
+    method_invoke_test obj;
+    CHECK(meth.invoke_variadic(obj, argument_range(args, args + 6)).is_valid() == false);
+    CHECK(obj.m_invoked[7] == false);
+
+    CHECK(meth.invoke_variadic(obj, argument_range(args)).is_valid() == true);
+    CHECK(obj.m_invoked[7] == true);
+
+    obj.m_invoked[7] = false;
+    CHECK(t.invoke("func_7", obj, args).is_valid() == true);
+    CHECK(obj.m_invoked[7] == true);
+
+    double h = 23.0;
+    argument overload_args[] = {a, h};
+    CHECK(t.invoke("func_overloaded", instance(), argument_range(overload_args, overload_args + 1)).get_value<int>() == 1);
+    CHECK(t.invoke("func_overloaded", instance(), argument_range(overload_args, overload_args + 2)).get_value<int>() == 4);
+    CHECK(t.invoke("func_overloaded", instance(), argument_range(overload_args + 1, overload_args + 2)).get_value<int>() == 2);
+    CHECK(t.invoke("func_overloaded", instance(), argument_range(overload_args, overload_args)).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - invoke - brace-enclosed argument list", "[method]")
+{
+    // a brace-enclosed list of two values must not be ambiguous between 'std::vector<argument>' and 'argument_range'
+    type t = type::get<method_invoke_test>();
+    method meth = t.get_method("func_2");
+    REQUIRE(meth.is_valid() == true);
+
+    method_invoke_test obj;
+    CHECK(meth.invoke_variadic(obj, {0, 5}).is_valid() == true);
+    CHECK(obj.m_invoked[2] == true);
+
+    obj.m_invoked[2] = false;
+    CHECK(t.invoke("func_2", obj, {0, 5}).is_valid() == true);
+    CHECK(obj.m_invoked[2] == true);
+
+    CHECK(t.invoke("func_overloaded", instance(), {0, 5}).get_value<int>() == 3);
+    CHECK(t.invoke("func_overloaded", instance(), {0, 0}).get_value<int>() == 3);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
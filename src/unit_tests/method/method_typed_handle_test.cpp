@@ -0,0 +1,188 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+
+#include <functional>
+#include <string>
+
+#include <catch/catch.hpp>
+
+using namespace rttr;
+
+struct typed_handle_test
+{
+    int add(int a, int b) { m_invoked = true; return a + b; }
+    int get_value() const { return m_value; }
+    void set_value(int value) { m_value = value; }
+    const std::string& get_name() const { return m_name; }
+    void append(std::string& text, const std::string& suffix) { text += suffix; }
+    int scale(int value, int factor) { return value * factor; }
+
+    static int multiply(int a, int b) { return a * b; }
+
+    int         m_value = 12;
+    std::string m_name = "name";
+    bool        m_invoked = false;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<typed_handle_test>("typed_handle_test")
+        .method("add", &typed_handle_test::add)
+        .method("get_value", &typed_handle_test::get_value)
+        .method("set_value", &typed_handle_test::set_value)
+        .method("get_name", &typed_handle_test::get_name)
+        (
+            policy::meth::return_ref_as_ptr
+        )
+        .method("append", &typed_handle_test::append)
+        .method("scale", &typed_handle_test::scale)
+        (
+            default_arguments(2)
+        )
+        .method("multiply", &typed_handle_test::multiply)
+        .method("negate", [](int value) { return -value; })
+        .method("square", std::function<int(int)>([](int value) { return value * value; }))
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - bind_signature - member function", "[method]")
+{
+    type t = type::get<typed_handle_test>();
+    typed_handle_test obj;
+
+    auto add = t.get_method("add").bind_signature<int(typed_handle_test&, int, int)>();
+    REQUIRE(add.is_valid() == true);
+    CHECK(static_cast<bool>(add) == true);
+    CHECK(add(obj, 23, 42) == 65);
+    CHECK(add.invoke(obj, 1, 2) == 3);
+    CHECK(obj.m_invoked == true);
+
+    auto set_value = t.get_method("set_value").bind_signature<void(typed_handle_test&, int)>();
+    REQUIRE(set_value.is_valid() == true);
+    set_value(obj, 42);
+    CHECK(obj.m_value == 42);
+
+    auto append = t.get_method("append").bind_signature<void(typed_handle_test&, std::string&, const std::string&)>();
+    REQUIRE(append.is_valid() == true);
+    std::string text = "hello";
+    append(obj, text, " world");
+    CHECK(text == "hello world");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - bind_signature - const member function", "[method]")
+{
+    type t = type::get<typed_handle_test>();
+    typed_handle_test obj;
+    const typed_handle_test& const_obj = obj;
+
+    auto get_value = t.get_method("get_value").bind_signature<int(typed_handle_test&)>();
+    REQUIRE(get_value.is_valid() == true);
+    CHECK(get_value(obj) == 12);
+
+    auto get_value_const = t.get_method("get_value").bind_signature<int(const typed_handle_test&)>();
+    REQUIRE(get_value_const.is_valid() == true);
+    CHECK(get_value_const(const_obj) == 12);
+
+    // the policy of the method does not apply, the reference is returned as it is
+    auto get_name = t.get_method("get_name").bind_signature<const std::string&(const typed_handle_test&)>();
+    REQUIRE(get_name.is_valid() == true);
+    CHECK(&get_name(const_obj) == &obj.m_name);
+
+    // a non-const member function cannot be bound with a const object
+    CHECK(t.get_method("set_value").bind_signature<void(const typed_handle_test&, int)>().is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - bind_signature - static function and function objects", "[method]")
+{
+    type t = type::get<typed_handle_test>();
+
+    auto multiply = t.get_method("multiply").bind_signature<int(int, int)>();
+    REQUIRE(multiply.is_valid() == true);
+    CHECK(multiply(6, 7) == 42);
+
+    auto negate = t.get_method("negate").bind_signature<int(int)>();
+    REQUIRE(negate.is_valid() == true);
+    CHECK(negate(23) == -23);
+
+    auto square = t.get_method("square").bind_signature<int(int)>();
+    REQUIRE(square.is_valid() == true);
+    CHECK(square(5) == 25);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - bind_signature - default arguments", "[method]")
+{
+    type t = type::get<typed_handle_test>();
+    typed_handle_test obj;
+
+    // default arguments are not considered, all parameters have to be provided
+    auto scale = t.get_method("scale").bind_signature<int(typed_handle_test&, int, int)>();
+    REQUIRE(scale.is_valid() == true);
+    CHECK(scale(obj, 21, 2) == 42);
+
+    CHECK(t.get_method("scale").bind_signature<int(typed_handle_test&, int)>().is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - bind_signature - NEGATIVE", "[method]")
+{
+    type t = type::get<typed_handle_test>();
+    method add = t.get_method("add");
+
+    CHECK(add.bind_signature<int(int, int)>().is_valid() == false);
+    CHECK(add.bind_signature<long(typed_handle_test&, int, int)>().is_valid() == false);
+    CHECK(add.bind_signature<void(typed_handle_test&, int, int)>().is_valid() == false);
+    CHECK(add.bind_signature<int(typed_handle_test&, const int&, int)>().is_valid() == false);
+    CHECK(add.bind_signature<int(typed_handle_test&, int)>().is_valid() == false);
+    CHECK(add.bind_signature<int(const typed_handle_test&, int, int)>().is_valid() == false);
+
+    CHECK(t.get_method("append").bind_signature<void(typed_handle_test&, std::string, std::string)>().is_valid() == false);
+    CHECK(t.get_method("multiply").bind_signature<int(typed_handle_test&, int, int)>().is_valid() == false);
+
+    method invalid_meth = t.get_method("");
+    REQUIRE(invalid_meth.is_valid() == false);
+    CHECK(invalid_meth.bind_signature<int(int, int)>().is_valid() == false);
+
+    typed_method_handle<int(int)> handle;
+    CHECK(handle.is_valid() == false);
+    CHECK(static_cast<bool>(handle) == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,117 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+#include <rttr/detail/misc/flat_map.h>
+#include <rttr/detail/misc/flat_multimap.h>
+
+#include <string>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+using namespace rttr;
+using namespace std;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("flat_map - insert", "[flat_map]")
+{
+    detail::flat_map<std::string, int> map;
+    map.insert(std::make_pair(std::string("one"), 1));
+    map.insert(std::make_pair(std::string("two"), 2));
+    map.insert(std::make_pair(std::string("one"), 23)); // already inserted => ignored
+
+    REQUIRE(map.value_data().size() == 2);
+    REQUIRE(map.find(std::string("one")) != map.end());
+    CHECK(*map.find(std::string("one")) == 1);
+    CHECK(*map.find(std::string("two")) == 2);
+    CHECK(map.find(std::string("three")) == map.end());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("flat_map - bulk insert", "[flat_map]")
+{
+    detail::flat_map<std::string, int> map;
+    map.insert(std::make_pair(std::string("item_0"), 0));
+
+    map.begin_bulk_insert();
+    for (int i = 1; i < 1000; ++i)
+        map.insert(std::make_pair("item_" + std::to_string(i), i));
+
+    // the unsorted items has to be found also before the bulk insert has finished
+    REQUIRE(map.find(std::string("item_999")) != map.end());
+    CHECK(*map.find(std::string("item_999")) == 999);
+
+    map.insert(std::make_pair(std::string("item_42"), 23)); // already inserted => ignored
+
+    // erasing an item during the bulk insert sorts the items inserted so far
+    map.erase(std::string("item_500"));
+    CHECK(map.find(std::string("item_500")) == map.end());
+    map.insert(std::make_pair(std::string("item_500"), 500));
+    map.insert(std::make_pair(std::string("item_1000"), 1000));
+    REQUIRE(map.find(std::string("item_999")) != map.end());
+    CHECK(*map.find(std::string("item_999")) == 999);
+    map.end_bulk_insert();
+
+    REQUIRE(map.value_data().size() == 1001);
+    for (int i = 0; i < 1001; ++i)
+    {
+        const auto itr = map.find("item_" + std::to_string(i));
+        REQUIRE(itr != map.end());
+        CHECK(*itr == i);
+    }
+
+    map.erase(std::string("item_42"));
+    CHECK(map.find(std::string("item_42")) == map.end());
+    CHECK(map.value_data().size() == 1000);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("flat_multimap - insert", "[flat_multimap]")
+{
+    detail::flat_multimap<std::string, int> map;
+    map.insert(std::make_pair(std::string("one"), 1));
+    map.insert(std::make_pair(std::string("two"), 2));
+    map.insert(std::make_pair(std::string("one"), 3));
+
+    REQUIRE(map.value_data().size() == 3);
+
+    // items with the same key are stored in insertion order
+    auto itr = map.find(std::string("one"));
+    REQUIRE(itr != map.end());
+    CHECK(*itr == 1);
+    ++itr;
+    REQUIRE(itr != map.end());
+    CHECK(*itr == 3);
+
+    CHECK(*map.find(std::string("two")) == 2);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,85 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+#include <rttr/detail/misc/flat_map.h>
+#include <rttr/detail/misc/flat_multimap.h>
+#include <rttr/detail/misc/hash_index.h>
+
+#include <string>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+using namespace rttr;
+using namespace std;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("hash_index - find", "[hash_index]")
+{
+    const std::vector<std::string> items = { "zero", "one", "two", "three" };
+    detail::hash_index<std::string> index;
+    // "one" and "two" have the same (faked) hash value
+    index.rebuild({ {0, 0}, {1, 1}, {1, 2} });
+    index.insert({3, 3});
+
+    const auto any_item = [](const std::string&) { return true; };
+    REQUIRE(index.find(items, 1, any_item) != nullptr);
+    CHECK(*index.find(items, 1, any_item) == "one");
+    REQUIRE(index.find(items, 3, any_item) != nullptr);
+    CHECK(*index.find(items, 3, any_item) == "three");
+    CHECK(index.find(items, 2, any_item) == nullptr);
+
+    const auto is_two = [](const std::string& item) { return (item == "two"); };
+    REQUIRE(index.find(items, 1, is_two) != nullptr);
+    CHECK(*index.find(items, 1, is_two) == "two");
+    CHECK(index.find(items, 0, is_two) == nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("hash_index - find_unique", "[hash_index]")
+{
+    const std::vector<std::string> items = { "zero", "one", "two" };
+    detail::hash_index<std::string> index;
+    CHECK(index.find_unique(items, 0, [](const std::string&) { return true; }) == nullptr);
+
+    index.rebuild({ {0, 0}, {1, 1}, {1, 2} });
+
+    const auto any_item = [](const std::string&) { return true; };
+    REQUIRE(index.find_unique(items, 0, any_item) != nullptr);
+    CHECK(*index.find_unique(items, 0, any_item) == "zero");
+    // ambiguous hash value
+    CHECK(index.find_unique(items, 1, any_item) == nullptr);
+
+    const auto is_one = [](const std::string& item) { return (item == "one"); };
+    REQUIRE(index.find_unique(items, 1, is_one) != nullptr);
+    CHECK(*index.find_unique(items, 1, is_one) == "one");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
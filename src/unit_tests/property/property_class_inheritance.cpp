@@ -504,6 +504,8 @@ TEST_CASE("property - base class not registered", "[property]")
     auto base_type = type::get<base_prop_not_registered>();
 
     CHECK(t_prop.is_derived_from(base_type) == true);
+    CHECK(base_type.is_base_of(t_prop) == true);
+    CHECK(base_type.is_derived_from(t_prop) == false);
 
     auto range = base_type.get_derived_classes();
 
@@ -512,3 +514,50 @@ TEST_CASE("property - base class not registered", "[property]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+struct late_base_prop
+{
+    int base_value = 1;
+    RTTR_ENABLE()
+};
+
+struct late_derived_prop : late_base_prop
+{
+    int derived_value = 2;
+    RTTR_ENABLE(late_base_prop)
+};
+
+struct late_derived_2_prop : late_derived_prop
+{
+    RTTR_ENABLE(late_derived_prop)
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - class - inheritance - register base after derived", "[property]")
+{
+    const auto t_derived = type::get<late_derived_prop>();
+    const auto t_derived_2 = type::get<late_derived_2_prop>();
+
+    registration::class_<late_derived_prop>("late_derived_prop")
+        .property("derived_value", &late_derived_prop::derived_value);
+
+    REQUIRE(t_derived.get_properties().size() == 1);
+    CHECK(t_derived_2.get_properties().size() == 1);
+
+    registration::class_<late_base_prop>("late_base_prop")
+        .property("base_value", &late_base_prop::base_value);
+
+    auto range = t_derived.get_properties();
+    REQUIRE(range.size() == 2);
+    CHECK(range.begin()->get_name() == "base_value");
+    CHECK((++range.begin())->get_name() == "derived_value");
+
+    CHECK(t_derived_2.get_properties().size() == 2);
+    CHECK(t_derived_2.get_property("base_value").get_declaring_type() == type::get<late_base_prop>());
+
+    late_derived_2_prop obj;
+    CHECK(t_derived_2.get_property_value("base_value", obj).get_value<int>() == 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
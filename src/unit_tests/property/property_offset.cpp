@@ -0,0 +1,171 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+using namespace rttr;
+
+struct property_offset_base
+{
+    int     id = 0;
+};
+
+struct property_offset_derived : property_offset_base
+{
+};
+
+struct property_offset_other_base
+{
+    double  weight = 0.0;
+};
+
+struct property_offset_multiple_derived : property_offset_other_base, property_offset_base
+{
+    int     level = 0;
+};
+
+struct property_offset_test
+{
+    char    flag = 'a';
+    double  value = 1.0;
+    float   pos[3] = {1.0f, 2.0f, 3.0f};
+
+    int get_count() const { return 42; }
+};
+
+static int g_property_offset_value = 23;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<property_offset_derived>("property_offset_derived")
+        .property("id", &property_offset_derived::id);
+
+    registration::class_<property_offset_multiple_derived>("property_offset_multiple_derived")
+        .property("id", &property_offset_multiple_derived::id)
+        .property("level", &property_offset_multiple_derived::level);
+
+    registration::class_<property_offset_test>("property_offset_test")
+        .property("flag", &property_offset_test::flag)
+        (
+            policy::prop::bind_as_ptr
+        )
+        .property_readonly("value", &property_offset_test::value)
+        .property("pos", &property_offset_test::pos)
+        .property_readonly("count", &property_offset_test::get_count)
+        .property("static_value", &g_property_offset_value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - get_offset()", "[property]")
+{
+    const type t = type::get<property_offset_test>();
+    bool ok = false;
+
+    SECTION("member object")
+    {
+        CHECK(t.get_property("flag").get_offset(&ok) == offsetof(property_offset_test, flag));
+        CHECK(ok == true);
+        CHECK(t.get_property("value").get_offset(&ok) == offsetof(property_offset_test, value));
+        CHECK(ok == true);
+        CHECK(t.get_property("pos").get_offset(&ok) == offsetof(property_offset_test, pos));
+        CHECK(ok == true);
+    }
+
+    SECTION("member of base class")
+    {
+        ok = true;
+        CHECK(type::get<property_offset_derived>().get_property("id").get_offset(&ok) == 0);
+        CHECK(ok == false);
+    }
+
+    SECTION("member of non-primary base class")
+    {
+        const type derived_type = type::get<property_offset_multiple_derived>();
+
+        ok = true;
+        CHECK(derived_type.get_property("id").get_offset(&ok) == 0);
+        CHECK(ok == false);
+
+        property_offset_multiple_derived obj;
+        obj.level = 12;
+        const std::size_t offset = derived_type.get_property("level").get_offset(&ok);
+        REQUIRE(ok == true);
+        CHECK(*reinterpret_cast<const int*>(reinterpret_cast<const char*>(&obj) + offset) == 12);
+    }
+
+    SECTION("no member object")
+    {
+        ok = true;
+        CHECK(t.get_property("count").get_offset(&ok) == 0);
+        CHECK(ok == false);
+
+        ok = true;
+        CHECK(t.get_property("static_value").get_offset(&ok) == 0);
+        CHECK(ok == false);
+
+        ok = true;
+        CHECK(t.get_property("does_not_exist").get_offset(&ok) == 0);
+        CHECK(ok == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - get_offset() - copy column", "[property]")
+{
+    std::vector<property_offset_test> objects(4);
+    for (std::size_t i = 0; i < objects.size(); ++i)
+        objects[i].value = static_cast<double>(i) * 2.0;
+
+    const property prop = type::get<property_offset_test>().get_property("value");
+    const type value_type = prop.get_type();
+    REQUIRE(value_type.is_trivially_copyable() == true);
+    REQUIRE(value_type.get_sizeof() == sizeof(double));
+
+    bool ok = false;
+    const std::size_t offset = prop.get_offset(&ok);
+    REQUIRE(ok == true);
+
+    std::vector<double> column(objects.size());
+    for (std::size_t i = 0; i < objects.size(); ++i)
+        std::memcpy(&column[i], reinterpret_cast<const char*>(&objects[i]) + offset, value_type.get_sizeof());
+
+    for (std::size_t i = 0; i < objects.size(); ++i)
+        CHECK(column[i] == objects[i].value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
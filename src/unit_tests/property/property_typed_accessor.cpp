@@ -0,0 +1,196 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+
+#include <string>
+
+#include <catch/catch.hpp>
+
+using namespace rttr;
+
+struct typed_accessor_test
+{
+    int                 value = 12;
+    const double        ratio = 0.5;
+    std::string         text = "hello";
+    int                 array[2] = {1, 2};
+
+    float get_speed() const { return m_speed; }
+    void set_speed(float speed) { m_speed = speed; }
+
+    const std::string& get_name() const { return m_name; }
+    void set_name(const std::string& name) { m_name = name; }
+
+    int get_count() const { return m_count; }
+
+    float       m_speed = 1.5f;
+    std::string m_name = "name";
+    int         m_count = 3;
+};
+
+struct typed_accessor_derived_test : typed_accessor_test
+{
+};
+
+static int g_typed_accessor_value = 23;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<typed_accessor_test>("typed_accessor_test")
+        .property("value", &typed_accessor_test::value)
+        .property_readonly("ratio", &typed_accessor_test::ratio)
+        .property("text", &typed_accessor_test::text)
+        (
+            policy::prop::bind_as_ptr
+        )
+        .property("array", &typed_accessor_test::array)
+        .property("speed", &typed_accessor_test::get_speed, &typed_accessor_test::set_speed)
+        .property("name", &typed_accessor_test::get_name, &typed_accessor_test::set_name)
+        (
+            policy::prop::as_reference_wrapper
+        )
+        .property_readonly("count", &typed_accessor_test::get_count)
+        .property("static_value", &g_typed_accessor_value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - get_accessor() - member object", "[property]")
+{
+    typed_accessor_test obj;
+    const type t = type::get<typed_accessor_test>();
+
+    SECTION("read write")
+    {
+        auto accessor = t.get_property("value").get_accessor<typed_accessor_test, int>();
+        REQUIRE(accessor.is_valid() == true);
+        CHECK(static_cast<bool>(accessor) == true);
+        CHECK(accessor.is_readonly() == false);
+        CHECK(accessor.get(obj) == 12);
+        CHECK(accessor.set(obj, 42) == true);
+        CHECK(obj.value == 42);
+    }
+
+    SECTION("read only")
+    {
+        auto accessor = t.get_property("ratio").get_accessor<typed_accessor_test, double>();
+        REQUIRE(accessor.is_valid() == true);
+        CHECK(accessor.is_readonly() == true);
+        CHECK(accessor.get(obj) == 0.5);
+        CHECK(accessor.set(obj, 1.0) == false);
+        CHECK(obj.ratio == 0.5);
+    }
+
+    SECTION("bind_as_ptr policy")
+    {
+        auto accessor = t.get_property("text").get_accessor<typed_accessor_test, std::string>();
+        REQUIRE(accessor.is_valid() == true);
+        CHECK(accessor.get(obj) == "hello");
+        CHECK(accessor.set(obj, std::string("world")) == true);
+        CHECK(obj.text == "world");
+    }
+
+    SECTION("array member")
+    {
+        auto accessor = t.get_property("array").get_accessor<typed_accessor_test, int>();
+        CHECK(accessor.is_valid() == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - get_accessor() - member function", "[property]")
+{
+    typed_accessor_test obj;
+    const type t = type::get<typed_accessor_test>();
+
+    SECTION("getter and setter")
+    {
+        auto accessor = t.get_property("speed").get_accessor<typed_accessor_test, float>();
+        REQUIRE(accessor.is_valid() == true);
+        CHECK(accessor.is_readonly() == false);
+        CHECK(accessor.get(obj) == 1.5f);
+        CHECK(accessor.set(obj, 2.5f) == true);
+        CHECK(obj.m_speed == 2.5f);
+    }
+
+    SECTION("getter returning reference")
+    {
+        auto accessor = t.get_property("name").get_accessor<typed_accessor_test, std::string>();
+        REQUIRE(accessor.is_valid() == true);
+        CHECK(accessor.get(obj) == "name");
+        CHECK(accessor.set(obj, std::string("new name")) == true);
+        CHECK(obj.m_name == "new name");
+    }
+
+    SECTION("read only")
+    {
+        auto accessor = t.get_property("count").get_accessor<typed_accessor_test, int>();
+        REQUIRE(accessor.is_valid() == true);
+        CHECK(accessor.is_readonly() == true);
+        CHECK(accessor.get(obj) == 3);
+        CHECK(accessor.set(obj, 4) == false);
+        CHECK(obj.m_count == 3);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - get_accessor() - invalid", "[property]")
+{
+    const type t = type::get<typed_accessor_test>();
+
+    SECTION("value type mismatch")
+    {
+        CHECK((t.get_property("value").get_accessor<typed_accessor_test, double>().is_valid() == false));
+        CHECK((t.get_property("speed").get_accessor<typed_accessor_test, int>().is_valid() == false));
+    }
+
+    SECTION("class type mismatch")
+    {
+        CHECK((t.get_property("value").get_accessor<typed_accessor_derived_test, int>().is_valid() == false));
+    }
+
+    SECTION("static property")
+    {
+        CHECK((t.get_property("static_value").get_accessor<typed_accessor_test, int>().is_valid() == false));
+    }
+
+    SECTION("invalid property")
+    {
+        auto accessor = t.get_property("does_not_exist").get_accessor<typed_accessor_test, int>();
+        CHECK(accessor.is_valid() == false);
+        typed_accessor_test obj;
+        CHECK(accessor.set(obj, 1) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
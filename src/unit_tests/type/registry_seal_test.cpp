@@ -0,0 +1,149 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+#include <catch/catch.hpp>
+
+using namespace rttr;
+
+struct seal_test_base
+{
+    int     base_value = 1;
+    int     get_value() const { return base_value; }
+
+    RTTR_ENABLE()
+};
+
+struct seal_test_derived : seal_test_base
+{
+    int     derived_value = 2;
+    int     hidden_value = 3;
+    int     add(int a, int b = 10) { return a + b; }
+    double  add(double a, double b) { return a + b; }
+
+    RTTR_ENABLE(seal_test_base)
+};
+
+struct seal_test_late
+{
+    int     late_value = 4;
+
+    RTTR_ENABLE()
+};
+
+RTTR_REGISTRATION
+{
+    registration::class_<seal_test_base>("seal_test_base")
+        .property("base_value", &seal_test_base::base_value)
+        .method("get_value", &seal_test_base::get_value);
+
+    registration::class_<seal_test_derived>("seal_test_derived")
+        .property("derived_value", &seal_test_derived::derived_value)
+        .property("hidden_value", &seal_test_derived::hidden_value, registration::private_access)
+        .method("add", select_overload<int(int, int)>(&seal_test_derived::add))
+        (
+            default_arguments(10)
+        )
+        .method("add", select_overload<double(double, double)>(&seal_test_derived::add));
+
+    registration::class_<seal_test_late>("seal_test_late");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<std::string> get_names(array_range<property> range)
+{
+    std::vector<std::string> result;
+    for (const auto& prop : range)
+        result.push_back(prop.get_name().to_string());
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("registration::seal() - member queries", "[registration]")
+{
+    const auto t = type::get<seal_test_derived>();
+    const auto public_props = get_names(t.get_properties());
+    const auto all_props = get_names(t.get_properties(filter_item::instance_item | filter_item::public_access |
+                                                      filter_item::non_public_access));
+    const auto method_count = t.get_methods().size();
+
+    registration::seal();
+
+    CHECK(get_names(t.get_properties()) == public_props);
+    CHECK(get_names(t.get_properties(filter_item::instance_item | filter_item::public_access |
+                                     filter_item::non_public_access)) == all_props);
+    CHECK(get_names(t.get_properties()) == std::vector<std::string>({"base_value", "derived_value"}));
+    CHECK(get_names(t.get_properties(filter_item::instance_item | filter_item::public_access |
+                                     filter_item::declared_only)) == std::vector<std::string>({"derived_value"}));
+    CHECK(t.get_methods().size() == method_count);
+
+    CHECK(t.get_property("base_value").get_declaring_type() == type::get<seal_test_base>());
+    CHECK(t.get_property("hidden_value").get_access_level() == access_levels::private_access);
+    CHECK(t.get_property("unknown").is_valid() == false);
+    CHECK(type::get<seal_test_base>().get_property("derived_value").is_valid() == false);
+    CHECK(type::get<seal_test_derived*>().get_property("derived_value").is_valid() == true);
+
+    CHECK(t.get_method("get_value").is_valid() == true);
+    CHECK(t.get_method("add", {type::get<double>(), type::get<double>()}).get_return_type() == type::get<double>());
+
+    seal_test_derived obj;
+    CHECK(t.invoke("get_value", obj, {}).get_value<int>() == 1);
+    CHECK(t.invoke("add", obj, {1, 2}).get_value<int>() == 3);
+    CHECK(t.invoke("add", obj, {1}).get_value<int>() == 11);
+    CHECK(t.invoke("add", obj, {1.5, 2.0}).get_value<double>() == 3.5);
+    CHECK(t.invoke("add", obj, {1, 2, 3}).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("registration::seal() - register after seal", "[registration]")
+{
+    registration::seal();
+
+    const auto t = type::get<seal_test_late>();
+    CHECK(t.get_property("late_value").is_valid() == false);
+    CHECK(t.get_properties().empty() == true);
+
+    // a range of the snapshot stays valid, after the snapshot was discarded
+    const auto sealed_props = type::get<seal_test_derived>().get_properties();
+
+    registration::class_<seal_test_late>("seal_test_late")
+        .property("late_value", &seal_test_late::late_value);
+
+    CHECK(t.get_property("late_value").is_valid() == true);
+    CHECK(t.get_properties().size() == 1);
+    CHECK(get_names(sealed_props) == std::vector<std::string>({"base_value", "derived_value"}));
+
+    registration::seal();
+
+    CHECK(t.get_property("late_value").is_valid() == true);
+    CHECK(t.get_properties().size() == 1);
+    CHECK(get_names(sealed_props) == std::vector<std::string>({"base_value", "derived_value"}));
+    CHECK(type::get<seal_test_derived>().get_property("derived_value").is_valid() == true);
+}
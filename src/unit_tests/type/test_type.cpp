@@ -254,6 +254,30 @@ TEST_CASE("Test rttr::type - Virtual Inheritance", "[type]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("Test rttr::type - cast pointer adjustment", "[type]")
+{
+    FinalClass final;
+    ClassMultipleBaseA* base_a = &final;
+    ClassMultipleBaseE* base_e = &final;
+
+    // the same casts a second time, to make sure the result does not change
+    for (int i = 0; i < 2; ++i)
+    {
+        CHECK(rttr_cast<FinalClass*>(base_e) == &final);
+        CHECK(rttr_cast<ClassMultipleBaseE*>(base_a) == base_e);
+        CHECK(rttr_cast<ClassMultiple3C*>(base_a) == static_cast<ClassMultiple3C*>(&final));
+        CHECK(rttr_cast<ClassMultiple6D*>(base_e) == static_cast<ClassMultiple6D*>(&final));
+        CHECK(rttr_cast<ClassSingleBase*>(base_a) == nullptr);
+    }
+
+    DiamondBottom diamond;
+    DiamondLeft* left = &diamond;
+    CHECK(rttr_cast<DiamondRight*>(left) == static_cast<DiamondRight*>(&diamond));
+    CHECK(rttr_cast<DiamondTop*>(left) == static_cast<DiamondTop*>(&diamond));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("type - get_base_classes()", "[type]")
 {
     DiamondBottom d;
@@ -274,6 +298,34 @@ TEST_CASE("type - is_derived_from()", "[type]")
 
     REQUIRE(type::get(d).is_derived_from(type::get<DiamondTop>()) == true); // dynamic
     REQUIRE(type::get(d).is_derived_from<DiamondTop>() == true); // static
+
+    CHECK(type::get<DiamondLeft>().is_derived_from<DiamondTop>() == true);
+    CHECK(type::get<DiamondLeft>().is_derived_from<DiamondRight>() == false);
+    CHECK(type::get<DiamondTop>().is_derived_from<DiamondBottom>() == false);
+    CHECK(type::get<DiamondTop>().is_derived_from<int>() == false);
+    CHECK(type::get<int>().is_derived_from<DiamondTop>() == false);
+
+    CHECK(type::get<ClassSingle6A>().is_derived_from<ClassSingleBase>() == true);
+    CHECK(type::get<ClassSingle6A>().is_derived_from<ClassSingle3A>() == true);
+    CHECK(type::get<ClassSingle6A>().is_derived_from<ClassSingle3B>() == false);
+    CHECK(type::get<FinalClass>().is_derived_from<ClassMultipleBaseE>() == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("type - is_base_of()", "[type]")
+{
+    CHECK(type::get<DiamondTop>().is_base_of<DiamondBottom>() == true);
+    CHECK(type::get<DiamondTop>().is_base_of<DiamondTop>() == true);
+    CHECK(type::get<DiamondLeft>().is_base_of<DiamondBottom>() == true);
+    CHECK(type::get<DiamondLeft>().is_base_of<DiamondRight>() == false);
+    CHECK(type::get<DiamondBottom>().is_base_of<DiamondTop>() == false);
+    CHECK(type::get<int>().is_base_of<DiamondTop>() == false);
+
+    CHECK(type::get<ClassSingleBase>().is_base_of(type::get<ClassSingle6E>()) == true);
+    CHECK(type::get<ClassSingle3E>().is_base_of(type::get<ClassSingle6E>()) == true);
+    CHECK(type::get<ClassSingle3E>().is_base_of(type::get<ClassSingle6A>()) == false);
+    CHECK(type::get<ClassMultiple6C>().is_base_of(type::get<FinalClass>()) == true);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -341,6 +393,21 @@ TEST_CASE("Test rttr::type - Check is_arithmetic", "[type]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("Test rttr::type - Check is_trivially_copyable", "[type]")
+{
+    CHECK(type::get<int>().is_trivially_copyable()             == true);
+    CHECK(type::get<double>().is_trivially_copyable()          == true);
+    CHECK(type::get<int*>().is_trivially_copyable()            == true);
+    CHECK(type::get<int[4]>().is_trivially_copyable()          == true);
+    CHECK(type::get<E_Alignment>().is_trivially_copyable()     == true);
+
+    CHECK(type::get<std::string>().is_trivially_copyable()     == false);
+    CHECK(type::get<std::vector<int>>().is_trivially_copyable() == false);
+    CHECK(type::get<void>().is_trivially_copyable()            == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("Test rttr::type - Check is_class", "[type]")
 {
 
@@ -28,6 +28,7 @@
 
 #include <catch/catch.hpp>
 #include <rttr/type>
+#include <rttr/registration>
 
 using namespace rttr;
 
@@ -43,6 +44,33 @@ TEST_CASE("type get_name", "[type]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+struct type_names_bulk_test {};
+
+TEST_CASE("type get_name - custom name in bulk registration", "[type]")
+{
+    // the pointer type is registered before its raw type gets the custom name
+    const type ptr_type = type::get<type_names_bulk_test*>();
+    {
+        detail::bulk_registration bulk_reg;
+        registration::class_<type_names_bulk_test>("bulk_test");
+        // the name index is rebuilt at the end of the registration, the lookups work also before
+        CHECK(type::get_by_name("bulk_test") == type::get<type_names_bulk_test>());
+        CHECK(type::get_by_name_hash(type::get_name_hash("bulk_test")) == type::get<type_names_bulk_test>());
+        CHECK(type::get_by_name("type_names_bulk_test").is_valid() == false);
+    }
+
+    CHECK(type::get<type_names_bulk_test>().get_name() == "bulk_test");
+    CHECK(ptr_type.get_name() == "bulk_test*");
+    CHECK(type::get_by_name("bulk_test*") == ptr_type);
+    CHECK(type::get<const type_names_bulk_test*>().get_name() == "const bulk_test*");
+    CHECK(type::get_by_name_hash(type::get_name_hash("bulk_test*")) == ptr_type);
+    // the replaced name cannot be found anymore, neither by name nor by its hash value
+    CHECK(type::get_by_name("type_names_bulk_test*").is_valid() == false);
+    CHECK(type::get_by_name_hash(type::get_name_hash("type_names_bulk_test*")).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("Test rttr::type - type::get_by_name", "[type]")
 {
     CHECK(type::get_by_name("std::string").is_valid()   == true);
@@ -55,3 +83,16 @@ TEST_CASE("Test rttr::type - type::get_by_name", "[type]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+
+TEST_CASE("Test rttr::type - type::get_by_name_hash", "[type]")
+{
+    CHECK(type::get_by_name_hash(type::get_name_hash("std::string")) == type::get<std::string>());
+    CHECK(type::get_by_name_hash(type::get_name_hash("int")) == type::get<int>());
+    CHECK(type::get_name_hash("int") != type::get_name_hash("int*"));
+
+    CHECK(type::get_by_name_hash(type::get_name_hash("std::string[200]")).is_valid() == false);
+    type::get<std::string[200]>();
+    CHECK(type::get_by_name_hash(type::get_name_hash("std::string[200]")) == type::get<std::string[200]>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
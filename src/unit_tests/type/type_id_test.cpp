@@ -0,0 +1,66 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+#include <catch/catch.hpp>
+
+#include <cstdint>
+#include <limits>
+
+using namespace rttr;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("type - id range", "[type]")
+{
+    static_assert(sizeof(type::type_id) >= sizeof(uint32_t), "the type id has to provide at least 32 bits");
+    const type::type_id invalid_id = detail::type_data::m_invalid_id;
+
+    SECTION("beyond 16 bit")
+    {
+        const type::type_id last_16_bit_id = std::numeric_limits<uint16_t>::max();
+        CHECK(detail::get_next_type_id(last_16_bit_id) == static_cast<type::type_id>(last_16_bit_id + 1));
+        CHECK(detail::get_next_type_id(last_16_bit_id) != invalid_id);
+    }
+
+    SECTION("all ids in use")
+    {
+        const type::type_id last_id = std::numeric_limits<type::type_id>::max();
+        CHECK(detail::get_next_type_id(last_id - 1) == last_id);
+        CHECK(detail::get_next_type_id(last_id) == invalid_id);
+    }
+
+    SECTION("registered types")
+    {
+        CHECK(detail::get_next_type_id(invalid_id) == 1);
+        CHECK(type::get<int>().get_id() != invalid_id);
+        CHECK(type::get<int>().get_id() != type::get<double>().get_id());
+        CHECK(type::get_by_name("int") == type::get<int>());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,93 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+#include <rttr/registration>
+#include <catch/catch.hpp>
+
+#include <deque>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+struct type_id_stress_test {};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("type - register more than 65535 types", "[type]")
+{
+    const std::size_t type_count = 100000;
+    const auto types_before = type::get_types().size();
+
+    // the registered types refer to their data and names, so these have to stay valid
+    static std::deque<std::string> names;
+    static std::deque<detail::type_data> data_list;
+
+    const auto& template_data = detail::get_type_data<type_id_stress_test>();
+    std::vector<type> types;
+    types.reserve(type_count);
+
+    detail::type_register::begin_bulk_registration();
+    for (std::size_t i = 0; i < type_count; ++i)
+    {
+        names.push_back("type_id_stress_test_" + std::to_string(i));
+
+        data_list.push_back(template_data);
+        auto& data = data_list.back();
+        data.type_name = names.back();
+
+        types.push_back(detail::type_register::type_reg(data));
+    }
+    detail::type_register::end_bulk_registration();
+
+    CHECK(type::get_types().size() == types_before + type_count);
+
+    const auto& first = types.front();
+    const auto& last = types.back();
+    REQUIRE(first.is_valid() == true);
+    REQUIRE(last.is_valid() == true);
+    CHECK(last.get_id() > std::numeric_limits<uint16_t>::max());
+    CHECK(last.get_id() - first.get_id() == type_count - 1);
+    CHECK(last.get_name() == "type_id_stress_test_99999");
+    CHECK(last.get_raw_type() == last);
+
+    CHECK(type::get_by_name("type_id_stress_test_0") == first);
+    CHECK(type::get_by_name("type_id_stress_test_70000") == types[70000]);
+    CHECK(type::get_by_name("type_id_stress_test_99999") == last);
+
+    // the side tables are indexed by the type id
+    detail::type_register::metadata(last, {metadata("id", 99999)});
+    CHECK(last.get_metadata("id") == 99999);
+    CHECK(first.get_metadata("id").is_valid() == false);
+
+    // already registered types are not changed by the new ids
+    CHECK(type::get<int>().get_id() < first.get_id());
+    CHECK(type::get_by_name("int") == type::get<int>());
+    CHECK(type::get<type_id_stress_test>() != first);
+}
@@ -37,6 +37,8 @@ set(SOURCE_FILES main.cpp
                  misc/array_range_test.cpp
                  misc/string_view_test.cpp
                  misc/enum_flags_test.cpp
+                 misc/flat_map_test.cpp
+                 misc/hash_index_test.cpp
                  property/property_access_level_test.cpp
                  property/property_misc_test.cpp
                  property/property_class_inheritance.cpp
@@ -45,9 +47,13 @@ set(SOURCE_FILES main.cpp
                  property/property_member_object.cpp
                  property/property_global_function.cpp
                  property/property_global_object.cpp
+                 property/property_offset.cpp
+                 property/property_typed_accessor.cpp
                  type/test_type.cpp
                  type/test_type_names.cpp
                  type/type_prop_meth_invoke.cpp
+                 type/registry_seal_test.cpp
+                 type/type_id_test.cpp
                  destructor/destructor_invoke_test.cpp
                  destructor/destructor_misc_test.cpp
                  constructor/constructor_access_level_test.cpp
@@ -66,6 +72,8 @@ set(SOURCE_FILES main.cpp
                  method/method_default_arg_test.cpp
                  method/method_misc_test.cpp
                  method/method_invoke_test.cpp
+                 method/method_typed_handle_test.cpp
+                 method/method_invoke_cache_test.cpp
                  method/method_param_info_test.cpp
                  method/method_query_test.cpp
                  variant/variant_assign_test.cpp
@@ -73,7 +81,10 @@ set(SOURCE_FILES main.cpp
                  variant/variant_ctor_test.cpp
                  variant/variant_cmp_equal_test.cpp
                  variant/variant_cmp_less_test.cpp
+                 variant/variant_hash_test.cpp
+                 variant/variant_ref_test.cpp
                  variant/variant_misc_test.cpp
+                 variant/variant_memory_resource_test.cpp
                  variant/variant_conv_to_bool.cpp
                  variant/variant_conv_to_int8.cpp
                  variant/variant_conv_to_int16.cpp
@@ -87,6 +98,7 @@ set(SOURCE_FILES main.cpp
                  variant/variant_conv_to_float.cpp
                  variant/variant_conv_to_string.cpp
                  variant/variant_conv_to_enum.cpp
+                 variant/variant_conv_range.cpp
                  variant_array_view/variant_array_view_test.cpp
                  variant_associative_view/variant_associative_view_test.cpp
                  )
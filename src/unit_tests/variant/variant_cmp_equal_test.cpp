@@ -188,6 +188,11 @@ TEST_CASE("variant::operator==() - enums", "[variant]")
 
     CHECK((a == b) == false);
     CHECK((a != b) == true);
+
+    CHECK((variant(COLOR::BLUE) == variant(static_cast<uint8_t>(2))) == true);
+    CHECK((variant(static_cast<int64_t>(2)) == variant(COLOR::BLUE)) == true);
+    CHECK((variant(COLOR::BLUE) == variant(static_cast<int8_t>(-2))) == false);
+    CHECK((variant(COLOR::GREEN) == variant(true)) == true);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,8 @@
 
 #include <rttr/type>
 #include <tuple>
+#include <vector>
+#include <algorithm>
 
 using namespace rttr;
 using namespace std;
@@ -114,6 +116,41 @@ TEST_CASE("variant::operator<() - integer", "[variant]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("variant::operator<() - mixed arithmetic types", "[variant]")
+{
+    CHECK((variant(1) < variant(1.5)) == true);
+    CHECK((variant(1.5f) < variant(static_cast<int64_t>(2))) == true);
+    CHECK((variant(static_cast<uint8_t>(200)) < variant(static_cast<int8_t>(-1))) == false);
+    CHECK((variant(false) < variant(static_cast<uint16_t>(1))) == true);
+
+    std::vector<variant> values = { 3.5, 1, static_cast<uint8_t>(2), -1.5f, static_cast<int64_t>(-4) };
+    std::sort(values.begin(), values.end());
+    REQUIRE(values.size() == 5);
+    CHECK(values[0] == variant(-4));
+    CHECK(values[1] == variant(-1.5f));
+    CHECK(values[2] == variant(1));
+    CHECK(values[3] == variant(2));
+    CHECK(values[4] == variant(3.5));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+enum class less_than_enum : uint8_t
+{
+    low     = 1,
+    high    = 200
+};
+
+TEST_CASE("variant::operator<() - enum", "[variant]")
+{
+    CHECK((variant(less_than_enum::low) < variant(less_than_enum::high)) == true);
+    CHECK((variant(less_than_enum::high) < variant(less_than_enum::low)) == false);
+    CHECK((variant(less_than_enum::low) < variant(2)) == true);
+    CHECK((variant(less_than_enum::high) < variant(2)) == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("variant::operator<() - float", "[variant]")
 {
     SECTION("lower < bigger")
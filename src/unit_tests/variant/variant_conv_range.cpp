@@ -0,0 +1,144 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <catch/catch.hpp>
+#include <rttr/registration>
+
+#include <vector>
+#include <string>
+#include <algorithm>
+
+using namespace rttr;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("convert_range() - to double", "[variant]")
+{
+    const std::vector<variant> values = { 1, 2, 3, 2.5f, 3.5f, std::string("4.5"), std::string("text"), variant(),
+                                          int64_t(-5), uint8_t(6), true, 7.5 };
+
+    std::vector<double> result(values.size(), -1.0);
+    bool ok[12];
+
+    const std::size_t count = convert_range(values.data(), values.data() + values.size(), result.data(), ok);
+    CHECK(count == 10);
+
+    const bool expected_ok[] = { true, true, true, true, true, true, false, false, true, true, true, true };
+    CHECK(std::equal(std::begin(ok), std::end(ok), std::begin(expected_ok)));
+
+    const double expected_result[] = { 1.0, 2.0, 3.0, 2.5, 3.5, 4.5, 0.0, 0.0, -5.0, 6.0, 1.0, 7.5 };
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        if (ok[i])
+            CHECK(result[i] == expected_result[i]);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("convert_range() - to int8_t", "[variant]")
+{
+    const std::vector<variant> values = { 1, 200, -128, -129, 2.0, 300.0, uint64_t(127), std::string("-12") };
+
+    std::vector<int8_t> result(values.size(), 0);
+    bool ok[8];
+
+    const std::size_t count = convert_range(values.data(), values.data() + values.size(), result.data(), ok);
+    CHECK(count == 5);
+
+    const bool expected_ok[] = { true, false, true, false, true, false, true, true };
+    CHECK(std::equal(std::begin(ok), std::end(ok), std::begin(expected_ok)));
+
+    // every element has to be converted in the same way as with 'convert()'
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        int8_t value = 0;
+        CHECK(values[i].convert(value) == ok[i]);
+        if (ok[i])
+            CHECK(value == result[i]);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("convert_range() - to std::string", "[variant]")
+{
+    const std::vector<variant> values = { 1, 2.5, true, std::string("text") };
+
+    std::vector<std::string> result(values.size());
+    const std::size_t count = convert_range(values.data(), values.data() + values.size(), result.data());
+    CHECK(count == 4);
+    CHECK(result == std::vector<std::string>({ "1", "2.5", "true", "text" }));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+enum class range_enum
+{
+    first = 1,
+    second = 2
+};
+
+RTTR_REGISTRATION
+{
+    registration::enumeration<range_enum>("range_enum")
+    (
+        value("first",  range_enum::first),
+        value("second", range_enum::second)
+    );
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("convert_range() - to enum", "[variant]")
+{
+    const std::vector<variant> values = { std::string("second"), 1, std::string("third") };
+
+    std::vector<range_enum> result(values.size(), range_enum::first);
+    bool ok[3];
+    const std::size_t count = convert_range(values.data(), values.data() + values.size(), result.data(), ok);
+    CHECK(count == 2);
+
+    CHECK(result[0] == range_enum::second);
+    CHECK(result[1] == range_enum::first);
+    CHECK(result[2] == range_enum::first);
+    CHECK(ok[0] == true);
+    CHECK(ok[1] == true);
+    CHECK(ok[2] == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("convert_range() - empty range", "[variant]")
+{
+    const variant* values = nullptr;
+    double result = 42.0;
+    CHECK(convert_range(values, values, &result) == 0);
+    CHECK(result == 42.0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
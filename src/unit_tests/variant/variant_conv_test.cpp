@@ -302,7 +302,7 @@ TEST_CASE("variant conversion - to std::string", "[variant]")
         CHECK(var.to_string() == "1.567");
 
         var = 3.12345678f;
-        CHECK(var.to_string() == "3.12346");
+        CHECK(var.to_string() == "3.1234567");
 
         var = 0.0f;
         CHECK(var.to_string() == "0");
@@ -703,3 +703,116 @@ TEST_CASE("variant test - convert from enum", "[variant]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant test - convert between all builtin types", "[variant]")
+{
+    const std::vector<variant> values = { true, '1', int8_t(1), int16_t(1), int32_t(1), int64_t(1),
+                                          uint8_t(1), uint16_t(1), uint32_t(1), uint64_t(1),
+                                          1.0f, 1.0, std::string("1") };
+
+    for (const auto& source : values)
+    {
+        for (const auto& target : values)
+        {
+            const type target_type = target.get_type();
+            CHECK(source.can_convert(target_type) == true);
+
+            variant var = source;
+            CHECK(var.convert(target_type) == true);
+            CHECK(var.get_type() == target_type);
+        }
+    }
+
+    variant var = std::string("1");
+    CHECK(var.convert(type::get<int64_t>()) == true);
+    CHECK(var.get_value<int64_t>() == 1);
+
+    CHECK(var.convert(type::get<double>()) == true);
+    CHECK(var.get_value<double>() == 1.0);
+
+    CHECK(var.convert(type::get<bool>()) == true);
+    CHECK(var.get_value<bool>() == true);
+
+    var = std::string("Hello World");
+    CHECK(var.can_convert(type::get<uint8_t>()) == true);
+    CHECK(var.convert(type::get<uint8_t>()) == false);
+    CHECK(var.is_type<std::string>() == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct length_m  { double value; };
+struct length_cm { double value; };
+struct length_mm { double value; };
+struct length_km { double value; };
+
+TEST_CASE("variant test - convert with a chain of converters", "[variant]")
+{
+    type::register_converter_func([](const length_m& l, bool& ok) { ok = true; return length_cm{l.value * 100.0}; });
+    type::register_converter_func([](const length_cm& l, bool& ok) { ok = true; return length_mm{l.value * 10.0}; });
+    type::register_converter_func([](const length_mm& l, bool& ok)
+    {
+        ok = (l.value >= 0.0);
+        return ok ? std::to_string(static_cast<int>(l.value)) : std::string();
+    });
+
+    SECTION("composed path")
+    {
+        variant var = length_m{1.5};
+        CHECK(var.can_convert<length_mm>() == true);
+        CHECK(var.can_convert<std::string>() == true);
+
+        bool ok = false;
+        const length_mm mm = var.convert<length_mm>(&ok);
+        CHECK(ok == true);
+        CHECK(mm.value == 1500.0);
+
+        CHECK(var.to_string(&ok) == "1500");
+        CHECK(ok == true);
+
+        // a second time, the cached path is used
+        CHECK(var.convert(type::get<std::string>()) == true);
+        REQUIRE(var.is_type<std::string>() == true);
+        CHECK(var.get_value<std::string>() == "1500");
+    }
+
+    SECTION("failing converter in the path")
+    {
+        variant var = length_m{-1.0};
+        bool ok = true;
+        var.to_string(&ok);
+        CHECK(ok == false);
+        CHECK(var.convert(type::get<std::string>()) == false);
+    }
+
+    SECTION("no path")
+    {
+        variant var = length_mm{1.0};
+        CHECK(var.can_convert<length_m>() == false);
+        CHECK(var.convert(type::get<length_m>()) == false);
+    }
+
+    SECTION("direct converter is preferred")
+    {
+        type::register_converter_func([](const length_m& l, bool& ok) { ok = true; return std::to_string(l.value) + " m"; });
+
+        variant var = length_m{2.0};
+        CHECK(var.to_string() == std::to_string(2.0) + " m");
+        CHECK(variant(length_cm{2.0}).to_string() == "20");
+    }
+
+    SECTION("new converter extends the cached paths")
+    {
+        variant var = length_cm{250000.0};
+        CHECK(var.can_convert<length_km>() == false);
+
+        type::register_converter_func([](const length_mm& l, bool& ok) { ok = true; return length_km{l.value / 1000000.0}; });
+
+        CHECK(var.can_convert<length_km>() == true);
+        bool ok = false;
+        CHECK(var.convert<length_km>(&ok).value == 2.5);
+        CHECK(ok == true);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
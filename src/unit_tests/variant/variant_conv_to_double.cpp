@@ -30,6 +30,9 @@
 #include <catch/catch.hpp>
 #include <rttr/type>
 
+#include <clocale>
+#include <string>
+
 using namespace rttr;
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -158,6 +161,52 @@ TEST_CASE("variant::to_double() - from std::string", "[variant]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+static void check_string_to_double_format()
+{
+    bool ok = false;
+    // more than 19 significant digits are not parsed by the fast path
+    CHECK(variant(std::string("0.12345678901234567890123")).to_double(&ok) == 0.12345678901234567890123);
+    CHECK(ok == true);
+    CHECK(variant(std::string("12345678901234567890.5e-10")).to_double(&ok) == 12345678901234567890.5e-10);
+    CHECK(ok == true);
+    CHECK(variant(std::string("0x1.8p1")).to_double(&ok) == 3.0);
+    CHECK(ok == true);
+
+    CHECK(variant(std::string("1,5")).to_double(&ok) == 0.0);
+    CHECK(ok == false);
+    CHECK(variant(std::string("0,12345678901234567890123")).to_double(&ok) == 0.0);
+    CHECK(ok == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::to_double() - from std::string, independent of the locale", "[variant]")
+{
+    SECTION("C locale")
+    {
+        check_string_to_double_format();
+    }
+
+    SECTION("locale with decimal comma")
+    {
+        const std::string previous_locale = std::setlocale(LC_NUMERIC, nullptr);
+        const char* const locale_names[] = { "de_DE.UTF-8", "de_DE.utf8", "de_DE", "German_Germany.1252" };
+        for (const auto name : locale_names)
+        {
+            // the locale is not available on every system
+            if (std::setlocale(LC_NUMERIC, name))
+            {
+                check_string_to_double_format();
+                break;
+            }
+        }
+
+        std::setlocale(LC_NUMERIC, previous_locale.c_str());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("variant::to_double() - from int", "[variant]")
 {
     SECTION("valid conversion positive")
@@ -29,6 +29,7 @@
 
 #include <catch/catch.hpp>
 #include <rttr/registration>
+#include <limits>
 
 using namespace rttr;
 
@@ -161,18 +162,18 @@ TEST_CASE("variant::to_string() - from float", "[variant]")
         variant var = 214748.9f;
         REQUIRE(var.can_convert<std::string>() == true);
         bool ok = false;
-        CHECK(var.to_string(&ok) == "214749");
+        CHECK(var.to_string(&ok) == "214748.9");
         CHECK(ok == true);
 
         REQUIRE(var.convert(type::get<std::string>()) == true);
-        CHECK(var.get_value<std::string>() == "214749");
+        CHECK(var.get_value<std::string>() == "214748.9");
     }
 
     SECTION("conversion negative")
     {
         variant var = -214748.9f;
         bool ok = false;
-        CHECK(var.to_string(&ok) == "-214749");
+        CHECK(var.to_string(&ok) == "-214748.9");
         CHECK(ok == true);
         CHECK(var.convert(type::get<std::string>()) == true);
     }
@@ -206,6 +207,54 @@ TEST_CASE("variant::to_string() - from double", "[variant]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("variant::to_string() - floating point round trip", "[variant]")
+{
+    SECTION("short representation")
+    {
+        CHECK(variant(0.1).to_string()      == "0.1");
+        CHECK(variant(0.1f).to_string()     == "0.1");
+        CHECK(variant(-0.0).to_string()     == "-0");
+        CHECK(variant(0.0001).to_string()   == "0.0001");
+        CHECK(variant(0.00001).to_string()  == "1e-05");
+        CHECK(variant(1e14).to_string()     == "100000000000000");
+        CHECK(variant(1e15).to_string()     == "1e+15");
+        CHECK(variant(1.5e300).to_string()  == "1.5e+300");
+        CHECK(variant(1e7f).to_string()     == "1e+07");
+        CHECK(variant(std::numeric_limits<double>::infinity()).to_string()  == "inf");
+        CHECK(variant(-std::numeric_limits<float>::infinity()).to_string()  == "-inf");
+    }
+
+    SECTION("double")
+    {
+        const double values[] = { 1.0 / 3.0, 2.0 / 3.0, 0.1 + 0.2, 123456789.123456789, 5e-324,
+                                  std::numeric_limits<double>::min(), std::numeric_limits<double>::max(),
+                                  std::numeric_limits<double>::epsilon(), -9007199254740993.0 };
+        for (const auto value : values)
+        {
+            bool ok = false;
+            const std::string text = variant(value).to_string();
+            CHECK(variant(text).to_double(&ok) == value);
+            CHECK(ok == true);
+        }
+    }
+
+    SECTION("float")
+    {
+        const float values[] = { 1.0f / 3.0f, 2.0f / 3.0f, 0.1f + 0.2f, 16777217.0f,
+                                 std::numeric_limits<float>::min(), std::numeric_limits<float>::max(),
+                                 std::numeric_limits<float>::epsilon(), -3.4028e38f };
+        for (const auto value : values)
+        {
+            bool ok = false;
+            const std::string text = variant(value).to_string();
+            CHECK(variant(text).to_float(&ok) == value);
+            CHECK(ok == true);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("variant::to_string() - from int8_t", "[variant]")
 {
     SECTION("valid conversion positive")
@@ -157,8 +157,8 @@ bool is_stored_internally(const void* obj, const rttr::variant& var)
 
 struct big_custom_type
 {
-    // two doubles, cannot be stored internally inside variant
-    std::aligned_storage<sizeof(double[2]), 8>::type m_data;
+    // one double more than the inline storage, cannot be stored internally inside variant
+    std::aligned_storage<RTTR_VARIANT_STORAGE_SIZE + sizeof(double), 8>::type m_data;
 };
 
 // this type should be stored internally inside variant class.
@@ -183,6 +183,12 @@ TEST_CASE("check storage type", "[variant]")
         CHECK( is_stored_internally(&obj_small, var) );
     }
 
+    {
+        variant var = std::string("hello");
+        const std::string& ref_str = var.get_value<std::string>();
+        CHECK( is_stored_internally(&ref_str, var) == (sizeof(std::string) <= RTTR_VARIANT_STORAGE_SIZE) );
+    }
+
     {
         variant var = true;
         const bool& ref_b = var.get_value<bool>();
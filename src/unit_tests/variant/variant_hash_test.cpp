@@ -0,0 +1,238 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <catch/catch.hpp>
+
+#include <rttr/type>
+#include "test_enums.h"
+
+#include <unordered_map>
+#include <unordered_set>
+#include <string>
+#include <functional>
+
+using namespace rttr;
+
+struct hash_test_id
+{
+    hash_test_id(int i) : id(i) {}
+    bool operator==(const hash_test_id& rhs) const { return (id == rhs.id); }
+
+    int id;
+};
+
+namespace std
+{
+    template <>
+    struct hash<hash_test_id>
+    {
+        size_t operator()(const hash_test_id& value) const { return hash<int>()(value.id); }
+    };
+} // end namespace std
+
+struct hash_test_unregistered
+{
+    int id;
+};
+
+enum class hash_test_long_enum : long long
+{
+    VALUE_1 = 1,
+    VALUE_2 = 2
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::get_hash() - invalid", "[variant]")
+{
+    variant var;
+    CHECK(var.get_hash() == 0);
+    CHECK(std::hash<variant>()(var) == 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::get_hash() - arithmetic types", "[variant]")
+{
+    SECTION("same type")
+    {
+        CHECK(variant(42).get_hash() == variant(42).get_hash());
+        CHECK(variant(42).get_hash() != variant(43).get_hash());
+        CHECK(variant(1.5).get_hash() == variant(1.5).get_hash());
+        CHECK(variant(1.5).get_hash() != variant(2.5).get_hash());
+    }
+
+    SECTION("different types with equal integral value")
+    {
+        const std::size_t hash = variant(42).get_hash();
+        CHECK(variant(static_cast<int8_t>(42)).get_hash()   == hash);
+        CHECK(variant(static_cast<uint16_t>(42)).get_hash() == hash);
+        CHECK(variant(static_cast<int64_t>(42)).get_hash()  == hash);
+        CHECK(variant(42.0f).get_hash()                     == hash);
+        CHECK(variant(42.0).get_hash()                      == hash);
+        CHECK(variant(true).get_hash() == variant(1).get_hash());
+        CHECK(variant(-1.0).get_hash() == variant(-1).get_hash());
+        CHECK(variant(0.0).get_hash() == variant(-0.0).get_hash());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::get_hash() - arithmetic types without built-in type", "[variant]")
+{
+    SECTION("long long")
+    {
+        CHECK(variant(1LL).get_hash() != variant(2LL).get_hash());
+        CHECK(variant(1ULL).get_hash() != variant(2ULL).get_hash());
+        CHECK(variant(1LL).get_hash() == variant(1).get_hash());
+        CHECK(variant(-1LL).get_hash() == variant(static_cast<int64_t>(-1)).get_hash());
+        CHECK(variant(42ULL).get_hash() == variant(42.0).get_hash());
+    }
+
+    SECTION("character types")
+    {
+        CHECK(variant(L'a').get_hash() != variant(L'b').get_hash());
+        CHECK(variant(L'a').get_hash() == variant(static_cast<int>(L'a')).get_hash());
+        CHECK(variant(u'a').get_hash() != variant(u'b').get_hash());
+        CHECK(variant(U'a').get_hash() != variant(U'b').get_hash());
+    }
+
+    SECTION("long double")
+    {
+        CHECK(variant(1.5L).get_hash() != variant(2.5L).get_hash());
+        CHECK(variant(2.0L).get_hash() == variant(2).get_hash());
+    }
+
+    SECTION("same hash as variant_ref")
+    {
+        long long i = 23;
+        wchar_t c = L'x';
+        CHECK(variant_ref(i).get_hash() == variant(i).get_hash());
+        CHECK(variant_ref(c).get_hash() == variant(c).get_hash());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::get_hash() - mixed floating point and integral types", "[variant]")
+{
+    SECTION("exactly equal")
+    {
+        CHECK(variant(7) == variant(7.0));
+        CHECK(variant(7).get_hash() == variant(7.0).get_hash());
+        CHECK(variant(static_cast<uint8_t>(7)) == variant(7.0f));
+        CHECK(variant(static_cast<uint8_t>(7)).get_hash() == variant(7.0f).get_hash());
+    }
+
+    SECTION("almost equal")
+    {
+        // the hash contract does not cover values, which are only equal within the tolerance of the comparison
+        const variant int_var = 1;
+        const variant double_var = 1.0000000000001;
+        CHECK(int_var == double_var);
+        CHECK(int_var.get_hash() != double_var.get_hash());
+
+        // converted to a common type, the values are compared exactly, so equality and hash agree again
+        const variant converted_var = int_var.to_double();
+        CHECK(converted_var != double_var);
+        CHECK(converted_var.get_hash() != double_var.get_hash());
+        CHECK(converted_var.get_hash() == int_var.get_hash());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::get_hash() - string types", "[variant]")
+{
+    CHECK(variant(std::string("hello")).get_hash() == variant(std::string("hello")).get_hash());
+    CHECK(variant(std::string("hello")).get_hash() != variant(std::string("world")).get_hash());
+    CHECK(variant(string_view("hello")).get_hash() == variant(std::string("hello")).get_hash());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::get_hash() - enum types", "[variant]")
+{
+    CHECK(variant(variant_enum_test_big::VALUE_1).get_hash() == variant(variant_enum_test_big::VALUE_1).get_hash());
+    CHECK(variant(variant_enum_test_big::VALUE_1).get_hash() != variant(variant_enum_test_big::VALUE_2).get_hash());
+    CHECK(variant(variant_enum_test_big::VALUE_1).get_hash() == variant(501).get_hash());
+
+    SECTION("underlying type without built-in type")
+    {
+        CHECK(variant(hash_test_long_enum::VALUE_1).get_hash() != variant(hash_test_long_enum::VALUE_2).get_hash());
+        CHECK(variant(hash_test_long_enum::VALUE_1).get_hash() == variant(1LL).get_hash());
+        CHECK(variant(hash_test_long_enum::VALUE_2).get_hash() == variant(2).get_hash());
+
+        const hash_test_long_enum value = hash_test_long_enum::VALUE_2;
+        CHECK(variant_ref(value).get_hash() == variant(value).get_hash());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::get_hash() - custom types", "[variant]")
+{
+    SECTION("pointer")
+    {
+        int value = 23;
+        CHECK(variant(&value).get_hash() == variant(&value).get_hash());
+    }
+
+    SECTION("unregistered type")
+    {
+        CHECK(variant(hash_test_unregistered{1}).get_hash() == variant(hash_test_unregistered{2}).get_hash());
+    }
+
+    SECTION("registered hasher")
+    {
+        type::register_hasher<hash_test_id>();
+        CHECK(variant(hash_test_id(23)).get_hash() == std::hash<hash_test_id>()(hash_test_id(23)));
+        CHECK(variant(hash_test_id(23)).get_hash() != variant(hash_test_id(42)).get_hash());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::get_hash() - hashed containers", "[variant]")
+{
+    std::unordered_map<variant, std::string> map;
+    map[variant(1)]                     = "one";
+    map[variant(std::string("two"))]    = "two";
+    map[variant(3.5)]                   = "three and a half";
+
+    CHECK(map.size() == 3);
+    CHECK(map[variant(1)] == "one");
+    CHECK(map[variant(static_cast<int64_t>(1))] == "one");
+    CHECK(map[variant(std::string("two"))] == "two");
+    CHECK(map[variant(3.5)] == "three and a half");
+    CHECK(map.size() == 3);
+
+    std::unordered_set<variant> set = { variant(1), variant(1.0), variant(2) };
+    CHECK(set.size() == 2);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,131 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <catch/catch.hpp>
+#include <rttr/type>
+#include <rttr/variant_memory_resource.h>
+
+#include <new>
+
+using namespace rttr;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct counting_memory_resource : variant_memory_resource
+{
+    void* allocate(std::size_t size, std::size_t alignment)
+    {
+        ++m_allocations;
+        m_allocated_bytes += size;
+        return ::operator new(size);
+    }
+
+    void deallocate(void* ptr, std::size_t size, std::size_t alignment) RTTR_NOEXCEPT
+    {
+        ++m_deallocations;
+        m_allocated_bytes -= size;
+        ::operator delete(ptr);
+    }
+
+    std::size_t m_allocations = 0;
+    std::size_t m_deallocations = 0;
+    std::size_t m_allocated_bytes = 0;
+};
+
+struct memory_resource_big_type
+{
+    std::aligned_storage<RTTR_VARIANT_STORAGE_SIZE + sizeof(double), 8>::type m_data;
+    int m_value = 42;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant - memory resource", "[variant]")
+{
+    CHECK(variant_memory_resource::get_memory_resource() == variant_memory_resource::get_default_resource());
+
+    counting_memory_resource resource;
+    auto prev_resource = variant_memory_resource::set_memory_resource(&resource);
+    CHECK(prev_resource == variant_memory_resource::get_default_resource());
+    CHECK(variant_memory_resource::get_memory_resource() == &resource);
+
+    SECTION("big types are allocated with the resource")
+    {
+        {
+            variant var = memory_resource_big_type();
+            CHECK(resource.m_allocations == 1);
+            CHECK(var.get_value<memory_resource_big_type>().m_value == 42);
+
+            variant var_copy = var;
+            CHECK(resource.m_allocations == 2);
+            CHECK(var_copy.get_value<memory_resource_big_type>().m_value == 42);
+
+            variant var_moved = std::move(var);
+            CHECK(resource.m_allocations == 2);
+        }
+
+        CHECK(resource.m_deallocations == 2);
+        CHECK(resource.m_allocated_bytes == 0);
+    }
+
+    SECTION("big arrays are allocated with the resource")
+    {
+        {
+            int array[100] = {1, 2, 3};
+            variant var = array;
+            CHECK(resource.m_allocations == 1);
+            CHECK(var.get_value<int[100]>()[2] == 3);
+        }
+
+        CHECK(resource.m_deallocations == 1);
+    }
+
+    SECTION("small types are not allocated")
+    {
+        {
+            variant var = 23;
+            CHECK(var.get_value<int>() == 23);
+        }
+
+        CHECK(resource.m_allocations == 0);
+    }
+
+    SECTION("values are deallocated by the resource, which allocated them")
+    {
+        variant var = memory_resource_big_type();
+        variant_memory_resource::set_memory_resource(nullptr);
+        CHECK(variant_memory_resource::get_memory_resource() == variant_memory_resource::get_default_resource());
+
+        var.clear();
+        CHECK(resource.m_allocations == 1);
+        CHECK(resource.m_deallocations == 1);
+    }
+
+    variant_memory_resource::set_memory_resource(prev_resource);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,8 @@
 
 #include <catch/catch.hpp>
 #include <iostream>
+#include <functional>
+#include <string>
 #include <rttr/type>
 
 using namespace rttr;
@@ -101,6 +103,43 @@ TEST_CASE("variant - swap", "[variant]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("variant - get_type after modification", "[variant]")
+{
+    // with RTTR_VARIANT_CACHE_TYPE the type is stored inside the variant, it has to follow every change of the value
+    variant a = 12;
+    variant b = a;
+    CHECK(b.get_type() == type::get<int>());
+
+    variant c = std::move(b);
+    CHECK(c.get_type() == type::get<int>());
+
+    c = std::string("text");
+    CHECK(c.get_type() == type::get<std::string>());
+
+    c = a;
+    CHECK(c.get_type() == type::get<int>());
+
+    c = variant();
+    CHECK(c.get_type().is_valid() == false);
+
+    c = std::move(a);
+    CHECK(c.get_type() == type::get<int>());
+
+    REQUIRE(c.convert(type::get<std::string>()) == true);
+    CHECK(c.get_type() == type::get<std::string>());
+    CHECK(c.get_value<std::string>() == "12");
+
+    int value = 5;
+    variant wrapped = std::ref(value);
+    CHECK(wrapped.get_type() == type::get<std::reference_wrapper<int>>());
+    CHECK(wrapped.extract_wrapped_value().get_type() == type::get<int>());
+
+    c.clear();
+    CHECK(c.get_type().is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("variant - get_wrapped_value", "[variant]")
 {
     int foo = 12;
@@ -0,0 +1,267 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <catch/catch.hpp>
+
+#include <rttr/registration>
+#include <rttr/type>
+#include "test_enums.h"
+
+#include <vector>
+#include <string>
+
+using namespace rttr;
+
+struct variant_ref_test
+{
+    int                         value = 23;
+    std::string                 text = "hello";
+    std::vector<std::string>    list = {"one", "two", "three"};
+    std::vector<bool>           flags = {true, false};
+    int*                        ptr = &value;
+
+    int get_value() const { return value; }
+    void set_value(int v) { value = v; }
+};
+
+static std::string g_variant_ref_text = "static";
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<variant_ref_test>("variant_ref_test")
+        .property("value", &variant_ref_test::value)
+        .property_readonly("text", &variant_ref_test::text)
+        .property("list", &variant_ref_test::list)
+        .property("ptr", &variant_ref_test::ptr)
+        .property("value_func", &variant_ref_test::get_value, &variant_ref_test::set_value);
+
+    registration::property("g_variant_ref_text", &g_variant_ref_text);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_ref - basic", "[variant_ref]")
+{
+    SECTION("empty")
+    {
+        variant_ref ref;
+        CHECK(ref.is_valid() == false);
+        CHECK((bool)ref == false);
+        CHECK(ref.get_type().is_valid() == false);
+        CHECK(ref.get_hash() == 0);
+    }
+
+    SECTION("from value")
+    {
+        std::string text = "hello";
+        variant_ref ref(text);
+        CHECK(ref.is_valid() == true);
+        CHECK(ref.get_type() == type::get<std::string>());
+        CHECK(ref.is_type<std::string>() == true);
+        CHECK(ref.is_type<int>() == false);
+        CHECK(&ref.get_value<std::string>() == &text);
+        CHECK(ref.get_ptr() == &text);
+    }
+
+    SECTION("from variant")
+    {
+        variant var = std::string("hello");
+        variant_ref ref(var);
+        CHECK(ref.get_type() == type::get<std::string>());
+        CHECK(&ref.get_value<std::string>() == &var.get_value<std::string>());
+
+        variant_ref invalid_ref{variant()};
+        CHECK(invalid_ref.is_valid() == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_ref - get_hash()", "[variant_ref]")
+{
+    const int i = 42;
+    const double d = 42.0;
+    const std::string text = "hello";
+    const variant_enum_test_big e = variant_enum_test_big::VALUE_1;
+
+    CHECK(variant_ref(i).get_hash() == variant(i).get_hash());
+    CHECK(variant_ref(d).get_hash() == variant(i).get_hash());
+    CHECK(variant_ref(text).get_hash() == variant(text).get_hash());
+    CHECK(variant_ref(e).get_hash() == variant(e).get_hash());
+    CHECK(variant_ref(&i).get_hash() == variant(&i).get_hash());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_ref - operator==", "[variant_ref]")
+{
+    SECTION("invalid")
+    {
+        CHECK(variant_ref() == variant_ref());
+        CHECK(variant_ref() != variant_ref(23));
+    }
+
+    SECTION("arithmetic types")
+    {
+        const int i = 42;
+        const double d = 42.0;
+        const float f = 42.5f;
+        CHECK(variant_ref(i) == variant_ref(d));
+        CHECK(variant_ref(i) != variant_ref(f));
+        CHECK(variant_ref(i) == variant_ref(42));
+    }
+
+    SECTION("string")
+    {
+        const std::string text_1 = "hello";
+        const std::string text_2 = "hello";
+        const std::string text_3 = "world";
+        CHECK(variant_ref(text_1) == variant_ref(text_2));
+        CHECK(variant_ref(text_1) != variant_ref(text_3));
+        CHECK(variant_ref(text_1) != variant_ref(23));
+    }
+
+    SECTION("enumeration")
+    {
+        const variant_enum_test_big e1 = variant_enum_test_big::VALUE_1;
+        const variant_enum_test_big e2 = variant_enum_test_big::VALUE_2;
+        const int i = static_cast<int>(variant_enum_test_big::VALUE_1);
+        CHECK(variant_ref(e1) == variant_ref(e1));
+        CHECK(variant_ref(e1) != variant_ref(e2));
+        CHECK(variant_ref(e1) == variant_ref(i));
+        CHECK(variant_ref(i) == variant_ref(e1));
+    }
+
+    SECTION("pointer")
+    {
+        int value = 23;
+        int* ptr_1 = &value;
+        int* ptr_2 = &value;
+        int* ptr_3 = nullptr;
+        CHECK(variant_ref(ptr_1) == variant_ref(ptr_2));
+        CHECK(variant_ref(ptr_1) != variant_ref(ptr_3));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property::get_ref()", "[variant_ref]")
+{
+    variant_ref_test obj;
+    type t = type::get<variant_ref_test>();
+
+    SECTION("member object")
+    {
+        variant_ref ref = t.get_property("value").get_ref(obj);
+        REQUIRE(ref.is_type<int>() == true);
+        CHECK(&ref.get_value<int>() == &obj.value);
+
+        obj.value = 42;
+        CHECK(ref.get_value<int>() == 42);
+    }
+
+    SECTION("read only member object")
+    {
+        variant_ref ref = t.get_property("text").get_ref(obj);
+        REQUIRE(ref.is_type<std::string>() == true);
+        CHECK(&ref.get_value<std::string>() == &obj.text);
+    }
+
+    SECTION("pointer member object")
+    {
+        variant_ref ref = t.get_property("ptr").get_ref(obj);
+        REQUIRE(ref.is_type<int*>() == true);
+        CHECK(ref.get_value<int*>() == &obj.value);
+    }
+
+    SECTION("global object")
+    {
+        variant_ref ref = type::get_global_property("g_variant_ref_text").get_ref(instance());
+        REQUIRE(ref.is_type<std::string>() == true);
+        CHECK(&ref.get_value<std::string>() == &g_variant_ref_text);
+    }
+
+    SECTION("getter function")
+    {
+        CHECK(t.get_property("value_func").get_ref(obj).is_valid() == false);
+    }
+
+    SECTION("invalid instance")
+    {
+        CHECK(t.get_property("value").get_ref(instance()).is_valid() == false);
+        int value = 23;
+        CHECK(t.get_property("value").get_ref(value).is_valid() == false);
+    }
+
+    SECTION("invalid property")
+    {
+        CHECK(t.get_property("does_not_exist").get_ref(obj).is_valid() == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_array_view::get_ref()", "[variant_ref]")
+{
+    variant_ref_test obj;
+
+    SECTION("dynamic array")
+    {
+        variant var = std::ref(obj.list);
+        auto view = var.create_array_view();
+        variant_ref ref = view.get_ref(1);
+        REQUIRE(ref.is_type<std::string>() == true);
+        CHECK(&ref.get_value<std::string>() == &obj.list[1]);
+        CHECK(view.get_ref(3).is_valid() == false);
+    }
+
+    SECTION("raw array")
+    {
+        int array[3] = {1, 2, 3};
+        variant var = std::ref(array);
+        variant_ref ref = var.create_array_view().get_ref(2);
+        REQUIRE(ref.is_type<int>() == true);
+        CHECK(&ref.get_value<int>() == &array[2]);
+    }
+
+    SECTION("array not returning by reference")
+    {
+        variant var = std::ref(obj.flags);
+        CHECK(var.create_array_view().get_ref(0).is_valid() == false);
+    }
+
+    SECTION("invalid view")
+    {
+        variant var = 23;
+        CHECK(var.create_array_view().get_ref(0).is_valid() == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////